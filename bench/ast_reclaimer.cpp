@@ -0,0 +1,52 @@
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/tracking/ast_reclaimer.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t functionCount = 500;
+
+    static constexpr size_t statementCount = 64;
+
+    static constexpr size_t iterations = 50;
+
+    /**
+     * Build, lower and drop a module, as a compile server would for
+     * each request. The module's last handle is dropped before returning.
+     */
+    static void compileAndDrop() {
+        std::shared_ptr<Module> module =
+            fixture::syntheticModule(functionCount, statementCount);
+
+        IonIrLoweringPass irLoweringPass{std::make_shared<ionshared::PassContext>()};
+
+        irLoweringPass.visitModule(module);
+        doNotOptimize(irLoweringPass.getModules());
+    }
+
+    IONLANG_BENCHMARK(astReclaimer) {
+        AstReclaimer& astReclaimer = AstReclaimer::getGlobal();
+        ReclaimMode previousMode = astReclaimer.getMode();
+
+        astReclaimer.setMode(ReclaimMode::Synchronous);
+        report(measureLatency("compile and drop: synchronous", iterations, compileAndDrop));
+
+        astReclaimer.setMode(ReclaimMode::Background);
+        report(measureLatency("compile and drop: background", iterations, compileAndDrop));
+
+        // Teardown alone, on the caller's thread.
+        astReclaimer.setMode(ReclaimMode::Synchronous);
+
+        std::vector<std::shared_ptr<Module>> modules{};
+
+        for (size_t i = 0; i < iterations + 1; i++) {
+            modules.push_back(fixture::syntheticModule(functionCount, statementCount));
+        }
+
+        report(measureLatency("drop: synchronous", iterations, [&] {
+            modules.pop_back();
+        }));
+
+        astReclaimer.setMode(previousMode);
+    }
+}
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include "bench.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ionlang::bench {
+    CacheMissCounter::CacheMissCounter() :
+        fileDescriptor(-1) {
+#ifdef __linux__
+        perf_event_attr attributes{};
+
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.size = sizeof(perf_event_attr);
+
+        attributes.config = PERF_COUNT_HW_CACHE_LL
+            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+
+        // Measure the calling thread, on any CPU.
+        this->fileDescriptor = static_cast<int>(
+            syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0)
+        );
+#endif
+    }
+
+    CacheMissCounter::~CacheMissCounter() {
+#ifdef __linux__
+        if (this->isAvailable()) {
+            close(this->fileDescriptor);
+        }
+#endif
+    }
+
+    bool CacheMissCounter::isAvailable() const noexcept {
+        return this->fileDescriptor >= 0;
+    }
+
+    void CacheMissCounter::start() {
+#ifdef __linux__
+        if (this->isAvailable()) {
+            ioctl(this->fileDescriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(this->fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    std::optional<uint64_t> CacheMissCounter::stop() {
+#ifdef __linux__
+        if (!this->isAvailable()) {
+            return std::nullopt;
+        }
+
+        ioctl(this->fileDescriptor, PERF_EVENT_IOC_DISABLE, 0);
+
+        uint64_t count = 0;
+
+        if (read(this->fileDescriptor, &count, sizeof(count)) != sizeof(count)) {
+            return std::nullopt;
+        }
+
+        return count;
+#else
+        return std::nullopt;
+#endif
+    }
+
+    std::vector<Benchmark>& getBenchmarks() {
+        static std::vector<Benchmark> benchmarks{};
+
+        return benchmarks;
+    }
+
+    Registration::Registration(std::string name, Callback callback) {
+        getBenchmarks().push_back(Benchmark{std::move(name), std::move(callback)});
+    }
+
+    Measurement measure(
+        const std::string& name,
+        size_t iterations,
+        const Callback& callback
+    ) {
+        // Warm up caches and allocators.
+        callback();
+
+        CacheMissCounter cacheMissCounter{};
+
+        cacheMissCounter.start();
+
+        std::chrono::steady_clock::time_point startTime =
+            std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < iterations; i++) {
+            callback();
+        }
+
+        std::chrono::steady_clock::time_point endTime =
+            std::chrono::steady_clock::now();
+
+        std::optional<uint64_t> cacheMisses = cacheMissCounter.stop();
+
+        double elapsedNanoseconds = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count()
+        );
+
+        return Measurement{
+            name,
+            iterations,
+            elapsedNanoseconds / static_cast<double>(iterations),
+
+            cacheMisses.has_value()
+                ? std::optional<double>(static_cast<double>(*cacheMisses) / static_cast<double>(iterations))
+                : std::nullopt
+        };
+    }
+
+    LatencyMeasurement measureLatency(
+        const std::string& name,
+        size_t iterations,
+        const Callback& callback
+    ) {
+        // Warm up caches and allocators.
+        callback();
+
+        std::vector<double> samples{};
+
+        samples.reserve(iterations);
+
+        for (size_t i = 0; i < iterations; i++) {
+            std::chrono::steady_clock::time_point startTime =
+                std::chrono::steady_clock::now();
+
+            callback();
+
+            std::chrono::steady_clock::time_point endTime =
+                std::chrono::steady_clock::now();
+
+            samples.push_back(static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count()
+            ));
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        return LatencyMeasurement{
+            name,
+            iterations,
+            samples[samples.size() / 2],
+            samples[std::min(samples.size() - 1, samples.size() * 99 / 100)],
+            samples.back()
+        };
+    }
+
+    void report(const Measurement& measurement) {
+        std::cout << std::left << std::setw(48) << measurement.name
+            << std::right << std::setw(14) << std::fixed << std::setprecision(1)
+            << measurement.nanosecondsPerIteration << " ns/iter";
+
+        if (measurement.cacheMissesPerIteration.has_value()) {
+            std::cout << std::setw(14) << *measurement.cacheMissesPerIteration
+                << " LLC misses/iter";
+        }
+        else {
+            std::cout << std::setw(14) << "n/a" << " LLC misses/iter";
+        }
+
+        std::cout << std::endl;
+    }
+
+    void report(const LatencyMeasurement& measurement) {
+        std::cout << std::left << std::setw(48) << measurement.name
+            << std::right << std::fixed << std::setprecision(1)
+            << " p50 " << std::setw(12) << measurement.medianNanoseconds / 1000 << " us"
+            << " p99 " << std::setw(12) << measurement.p99Nanoseconds / 1000 << " us"
+            << " max " << std::setw(12) << measurement.maxNanoseconds / 1000 << " us"
+            << std::endl;
+    }
+}
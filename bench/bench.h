@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ionlang::bench {
+    struct Measurement {
+        std::string name;
+
+        size_t iterations;
+
+        double nanosecondsPerIteration;
+
+        /**
+         * Last level cache read misses per iteration. Has no value if
+         * hardware counters are unavailable (unsupported platform,
+         * virtualized environment or insufficient permissions).
+         */
+        std::optional<double> cacheMissesPerIteration;
+    };
+
+    struct LatencyMeasurement {
+        std::string name;
+
+        size_t iterations;
+
+        double medianNanoseconds;
+
+        double p99Nanoseconds;
+
+        double maxNanoseconds;
+    };
+
+    /**
+     * Counts last level cache read misses of the calling thread,
+     * using perf events where available.
+     */
+    class CacheMissCounter {
+    private:
+        int fileDescriptor;
+
+    public:
+        CacheMissCounter();
+
+        ~CacheMissCounter();
+
+        CacheMissCounter(const CacheMissCounter& other) = delete;
+
+        CacheMissCounter& operator=(const CacheMissCounter& other) = delete;
+
+        [[nodiscard]] bool isAvailable() const noexcept;
+
+        void start();
+
+        [[nodiscard]] std::optional<uint64_t> stop();
+    };
+
+    typedef std::function<void()> Callback;
+
+    struct Benchmark {
+        std::string name;
+
+        Callback callback;
+    };
+
+    [[nodiscard]] std::vector<Benchmark>& getBenchmarks();
+
+    /**
+     * Registers a benchmark upon static initialization. Use the
+     * IONLANG_BENCHMARK macro instead of using this directly.
+     */
+    struct Registration {
+        Registration(std::string name, Callback callback);
+    };
+
+    /**
+     * Run the callback the provided amount of times after a single
+     * warm-up run, and report the averaged results.
+     */
+    Measurement measure(
+        const std::string& name,
+        size_t iterations,
+        const Callback& callback
+    );
+
+    /**
+     * Time each run of the callback individually, after a single warm-up
+     * run, and report the latency distribution.
+     */
+    LatencyMeasurement measureLatency(
+        const std::string& name,
+        size_t iterations,
+        const Callback& callback
+    );
+
+    void report(const Measurement& measurement);
+
+    void report(const LatencyMeasurement& measurement);
+
+    /**
+     * Prevent the compiler from optimizing away a computed value.
+     */
+    template<typename T>
+    void doNotOptimize(const T& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+}
+
+#define IONLANG_BENCHMARK(name) \
+    static void name(); \
+    static ionlang::bench::Registration name##Registration(#name, name); \
+    static void name()
@@ -0,0 +1,36 @@
+#include <iostream>
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/tracking/compile_profiler.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t iterations = 20;
+
+    /**
+     * Compare lowering a synthetic module with profiling disabled and
+     * enabled (including hardware counters, where available), then
+     * print the resulting compile time report.
+     */
+    IONLANG_BENCHMARK(compileProfiler) {
+        std::shared_ptr<Module> module = fixture::syntheticModule(2000, 64);
+
+        auto lower = [&] {
+            IonIrLoweringPass irLoweringPass{std::make_shared<ionshared::PassContext>()};
+
+            irLoweringPass.visitModule(module);
+        };
+
+        report(measure("lowering: profiling disabled", iterations, lower));
+        CompileProfiler::reset();
+        CompileProfiler::setEnabled(true);
+        CompileProfiler::setHardwareCountersEnabled(true);
+        report(measure("lowering: profiling enabled", iterations, lower));
+        CompileProfiler::setHardwareCountersEnabled(false);
+        CompileProfiler::setEnabled(false);
+        CompileProfiler::writeReport(std::cout);
+        CompileProfiler::writeJson(std::cout, 5);
+        std::cout << std::endl;
+        CompileProfiler::reset();
+    }
+}
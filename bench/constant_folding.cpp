@@ -0,0 +1,35 @@
+#include <iostream>
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/passes/optimization/constant_folding_pass.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t iterations = 20;
+
+    /**
+     * Compare lowering a synthetic module as is and once its constants
+     * were folded, then print how much folding removed.
+     */
+    IONLANG_BENCHMARK(constantFolding) {
+        std::shared_ptr<Module> module = fixture::syntheticModule(2000, 64);
+        std::shared_ptr<Module> foldedModule = fixture::syntheticModule(2000, 64);
+        ConstantFoldingPass constantFoldingPass{std::make_shared<ionshared::PassContext>()};
+
+        constantFoldingPass.visit(foldedModule);
+
+        report(measure("lowering: unfolded", iterations, [&] {
+            IonIrLoweringPass irLoweringPass{std::make_shared<ionshared::PassContext>()};
+
+            irLoweringPass.visitModule(module);
+        }));
+
+        report(measure("lowering: folded", iterations, [&] {
+            IonIrLoweringPass irLoweringPass{std::make_shared<ionshared::PassContext>()};
+
+            irLoweringPass.visitModule(foldedModule);
+        }));
+
+        constantFoldingPass.getStatistics().writeReport(std::cout);
+    }
+}
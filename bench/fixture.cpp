@@ -0,0 +1,177 @@
+#include <ionlang/type_system/type_factory.h>
+#include "fixture.h"
+
+namespace ionlang::bench::fixture {
+    static std::shared_ptr<VariableRefExpr> variableRef(
+        const std::shared_ptr<VariableDeclStmt>& variableDecl,
+        const std::shared_ptr<Block>& block
+    ) {
+        PtrResolvable<VariableDeclStmt> variableDeclRef =
+            Resolvable<VariableDeclStmt>::make(
+                ResolvableKind::VariableLike,
+                std::make_shared<Identifier>(variableDecl->name),
+                block
+            );
+
+        variableDeclRef->resolve(variableDecl);
+
+        return std::make_shared<VariableRefExpr>(variableDeclRef);
+    }
+
+    static void appendStatement(
+        const std::shared_ptr<Block>& block,
+        const std::shared_ptr<Statement>& statement
+    ) {
+        statement->setParent(block);
+        block->appendStatement(statement);
+    }
+
+    std::shared_ptr<Module> syntheticModule(size_t functionCount, size_t statementCount) {
+        std::shared_ptr<Module> module = std::make_shared<Module>("bench");
+        std::shared_ptr<Function> previousFunction = nullptr;
+
+        for (size_t i = 0; i < functionCount; i++) {
+            std::string functionName = "function_" + std::to_string(i);
+
+            std::shared_ptr<Function> function = Function::make(
+                Prototype::make(
+                    functionName,
+                    ArgumentList::make(),
+                    Resolvable<Type>::make(type_factory::typeVoid())
+                ),
+
+                Block::make()
+            );
+
+            function->setParent(module);
+            module->context->globalScope.set(functionName, function);
+
+            std::shared_ptr<Block> body = function->body;
+            std::vector<std::shared_ptr<VariableDeclStmt>> variableDecls{};
+
+            for (size_t j = 0; j < statementCount; j++) {
+                std::shared_ptr<Expression<>> value;
+
+                // Declare a constant, then alternate between arithmetic and assignments.
+                if (variableDecls.size() < 2 || j % 3 == 0) {
+                    value = IntegerLiteral::make(
+                        type_factory::typeInteger32(),
+                        static_cast<int64_t>(j)
+                    )->flattenExpression();
+                }
+                else {
+                    value = OperationExpr::make(
+                        Resolvable<Type>::make(type_factory::typeInteger32()),
+                        j % 2 == 0 ? IntrinsicOperatorKind::Addition : IntrinsicOperatorKind::Multiplication,
+                        variableRef(variableDecls[variableDecls.size() - 1], body),
+                        variableRef(variableDecls[variableDecls.size() - 2], body)->flattenExpression()
+                    )->flattenExpression();
+                }
+
+                if (j % 3 == 2) {
+                    PtrResolvable<VariableDeclStmt> variableDeclRef =
+                        Resolvable<VariableDeclStmt>::make(
+                            ResolvableKind::VariableLike,
+                            std::make_shared<Identifier>(variableDecls.back()->name),
+                            body
+                        );
+
+                    variableDeclRef->resolve(variableDecls.back());
+                    appendStatement(body, AssignmentStmt::make(variableDeclRef, value));
+
+                    continue;
+                }
+
+                std::shared_ptr<VariableDeclStmt> variableDecl = VariableDeclStmt::make(
+                    Resolvable<Type>::make(type_factory::typeInteger32()),
+                    "variable_" + std::to_string(j),
+                    value
+                );
+
+                appendStatement(body, variableDecl);
+                variableDecls.push_back(variableDecl);
+            }
+
+            if (previousFunction != nullptr) {
+                PtrResolvable<> calleeResolvable = Resolvable<>::make(
+                    ResolvableKind::FunctionLike,
+                    std::make_shared<Identifier>(previousFunction->prototype->name),
+                    body
+                );
+
+                calleeResolvable->resolve(previousFunction);
+
+                appendStatement(body, ExprWrapperStmt::make(CallExpr::make(
+                    calleeResolvable,
+                    {},
+                    Resolvable<Type>::make(type_factory::typeVoid())
+                )));
+            }
+
+            appendStatement(body, ReturnStmt::make(std::nullopt));
+            previousFunction = function;
+        }
+
+        return module;
+    }
+
+    std::shared_ptr<Module> nestedModule(size_t functionCount, size_t depth, size_t localCount) {
+        std::shared_ptr<Module> module = std::make_shared<Module>("bench");
+
+        for (size_t i = 0; i < functionCount; i++) {
+            std::string functionName = "function_" + std::to_string(i);
+
+            std::shared_ptr<Function> function = Function::make(
+                Prototype::make(
+                    functionName,
+                    ArgumentList::make(),
+                    Resolvable<Type>::make(type_factory::typeVoid())
+                ),
+
+                Block::make()
+            );
+
+            function->setParent(module);
+            module->context->globalScope.set(functionName, function);
+
+            std::shared_ptr<Block> block = function->body;
+
+            for (size_t level = 0; level < depth; level++) {
+                for (size_t j = 0; j < localCount; j++) {
+                    std::shared_ptr<Expression<>> value;
+
+                    if (level == 0) {
+                        value = IntegerLiteral::make(
+                            type_factory::typeInteger32(),
+                            static_cast<int64_t>(j)
+                        )->flattenExpression();
+                    }
+                    else {
+                        value = std::make_shared<VariableRefExpr>(
+                            Resolvable<VariableDeclStmt>::make(
+                                ResolvableKind::VariableLike,
+                                std::make_shared<Identifier>("local_0_" + std::to_string(j)),
+                                block
+                            )
+                        )->flattenExpression();
+                    }
+
+                    appendStatement(block, VariableDeclStmt::make(
+                        Resolvable<Type>::make(type_factory::typeInteger32()),
+                        "local_" + std::to_string(level) + "_" + std::to_string(j),
+                        value
+                    ));
+                }
+
+                std::shared_ptr<Block> nestedBlock = Block::make();
+
+                appendStatement(block, BlockWrapperStmt::make(nestedBlock));
+                block = nestedBlock;
+            }
+
+            appendStatement(function->body, ReturnStmt::make(std::nullopt));
+        }
+
+        return module;
+    }
+}
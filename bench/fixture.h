@@ -0,0 +1,30 @@
+#pragma once
+
+#include <ionlang/passes/pass.h>
+
+namespace ionlang::bench::fixture {
+    /**
+     * Create a module with the provided amount of functions, each with
+     * a straight-line body of roughly the provided amount of statements:
+     * integer variable declarations, arithmetic on previously declared
+     * variables, assignments and a call to the previous function. All
+     * references are resolved, as if name resolution had already run.
+     */
+    [[nodiscard]] std::shared_ptr<Module> syntheticModule(
+        size_t functionCount,
+        size_t statementCount
+    );
+
+    /**
+     * Create a module with the provided amount of functions, each with
+     * blocks nested to the provided depth. Every block declares the
+     * provided amount of integer locals, whose initializers (beyond the
+     * outermost block) refer to the locals of the outermost block. All
+     * references are left unresolved, for name resolution to resolve.
+     */
+    [[nodiscard]] std::shared_ptr<Module> nestedModule(
+        size_t functionCount,
+        size_t depth,
+        size_t localCount
+    );
+}
@@ -0,0 +1,71 @@
+#include <iostream>
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t iterations = 20;
+
+    static void lowerModule(
+        const std::shared_ptr<Module>& module,
+        bool useLinearBodies,
+        bool promoteImmutableLocals
+    ) {
+        IonIrLoweringPass irLoweringPass{
+            std::make_shared<ionshared::PassContext>(),
+            std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>(),
+
+            LoweringOptions{
+                .useLinearBodies = useLinearBodies,
+                .promoteImmutableLocals = promoteImmutableLocals
+            }
+        };
+
+        irLoweringPass.visitModule(module);
+        doNotOptimize(irLoweringPass.getModules());
+    }
+
+    /**
+     * Compare lowering every local onto a stack slot with binding the
+     * locals which are never assigned to directly to their value, then
+     * print how many locals are never assigned to. Those whose value is
+     * a constant or an emitted instruction avoid a stack slot and store.
+     */
+    IONLANG_BENCHMARK(immutableLocals) {
+        std::shared_ptr<Module> module = fixture::syntheticModule(2000, 64);
+        std::unordered_set<const VariableDeclStmt*> assignedVariableDecls{};
+        size_t variableDeclCount = 0;
+
+        for (const auto& [name, construct] : module->context->globalScope.getEntries()) {
+            for (const auto& statement : construct->staticCast<Function>()->body->statements) {
+                if (statement->statementKind == StatementKind::VariableDeclaration) {
+                    variableDeclCount++;
+                }
+                else if (statement->statementKind == StatementKind::Assignment) {
+                    assignedVariableDecls.insert(
+                        statement->staticCast<AssignmentStmt>()->variableDeclStmtRef->forceGetValue().get()
+                    );
+                }
+            }
+        }
+
+        report(measure("lower: stack slots", iterations, [&] {
+            lowerModule(module, false, false);
+        }));
+
+        report(measure("lower: promoted locals", iterations, [&] {
+            lowerModule(module, false, true);
+        }));
+
+        report(measure("lower: linear body, stack slots", iterations, [&] {
+            lowerModule(module, true, false);
+        }));
+
+        report(measure("lower: linear body, promoted locals", iterations, [&] {
+            lowerModule(module, true, true);
+        }));
+
+        std::cout << "  Locals:                 " << variableDeclCount << std::endl
+            << "  Never assigned to:      " << variableDeclCount - assignedVariableDecls.size() << std::endl;
+    }
+}
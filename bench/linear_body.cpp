@@ -0,0 +1,175 @@
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/passes/lowering/linear_body.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t functionCount = 200;
+
+    static constexpr size_t statementCount = 64;
+
+    static constexpr size_t iterations = 20;
+
+    static std::vector<std::shared_ptr<Block>> collectBodies(const std::shared_ptr<Module>& module) {
+        std::vector<std::shared_ptr<Block>> bodies{};
+
+        for (const auto& [name, construct] : module->context->globalScope.getEntries()) {
+            bodies.push_back(construct->staticCast<Function>()->body);
+        }
+
+        return bodies;
+    }
+
+    static int64_t traverseExpression(const std::shared_ptr<Expression<>>& expression) {
+        switch (expression->expressionKind) {
+            case ExpressionKind::IntegerLiteral: {
+                return expression->staticCast<IntegerLiteral>()->value;
+            }
+
+            case ExpressionKind::Operation: {
+                std::shared_ptr<OperationExpr> operation =
+                    expression->staticCast<OperationExpr>();
+
+                int64_t result = traverseExpression(operation->leftSideValue);
+
+                if (ionshared::util::hasValue(operation->rightSideValue)) {
+                    result += traverseExpression(*operation->rightSideValue);
+                }
+
+                return result + 1;
+            }
+
+            default: {
+                return 1;
+            }
+        }
+    }
+
+    /**
+     * Visit every statement and expression of a body through the
+     * construct tree, the same way lowering does.
+     */
+    static int64_t traverseTree(const std::shared_ptr<Block>& block) {
+        int64_t result = 0;
+
+        for (const auto& statement : block->statements) {
+            switch (statement->statementKind) {
+                case StatementKind::VariableDeclaration: {
+                    result += traverseExpression(statement->staticCast<VariableDeclStmt>()->value);
+
+                    break;
+                }
+
+                case StatementKind::Assignment: {
+                    result += traverseExpression(statement->staticCast<AssignmentStmt>()->value);
+
+                    break;
+                }
+
+                default: {
+                    result++;
+
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Visit every node of a linearized body, in storage order.
+     */
+    static int64_t traverseLinear(const LinearBody& linearBody) {
+        int64_t result = 0;
+
+        for (const auto& node : linearBody.nodes) {
+            switch (node.kind) {
+                case LinearNodeKind::IntegerLiteral: {
+                    result += linearBody.integers[node.first];
+
+                    break;
+                }
+
+                // Statement values and call expressions are not counted by the tree traversal.
+                case LinearNodeKind::VariableDecl:
+                case LinearNodeKind::Assignment:
+                case LinearNodeKind::Call: {
+                    break;
+                }
+
+                default: {
+                    result++;
+
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    static void lowerModule(const std::shared_ptr<Module>& module, bool useLinearBodies) {
+        IonIrLoweringPass irLoweringPass{
+            std::make_shared<ionshared::PassContext>(),
+            std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>(),
+            LoweringOptions{.useLinearBodies = useLinearBodies}
+        };
+
+        irLoweringPass.visitModule(module);
+        doNotOptimize(irLoweringPass.getModules());
+    }
+
+    IONLANG_BENCHMARK(linearBody) {
+        std::shared_ptr<Module> module =
+            fixture::syntheticModule(functionCount, statementCount);
+
+        std::vector<std::shared_ptr<Block>> bodies = collectBodies(module);
+        std::vector<LinearBody> linearBodies{};
+
+        for (const auto& body : bodies) {
+            std::optional<LinearBody> linearBody = LinearBody::fromBlock(body);
+
+            if (!linearBody.has_value()) {
+                throw std::runtime_error("Synthetic function body could not be linearized");
+            }
+
+            linearBodies.push_back(std::move(*linearBody));
+        }
+
+        report(measure("linearize", iterations, [&] {
+            for (const auto& body : bodies) {
+                doNotOptimize(LinearBody::fromBlock(body));
+            }
+        }));
+
+        report(measure("traverse: construct tree", iterations, [&] {
+            int64_t result = 0;
+
+            for (const auto& body : bodies) {
+                result += traverseTree(body);
+            }
+
+            doNotOptimize(result);
+        }));
+
+        report(measure("traverse: linear body", iterations, [&] {
+            int64_t result = 0;
+
+            for (const auto& linearBody : linearBodies) {
+                result += traverseLinear(linearBody);
+            }
+
+            doNotOptimize(result);
+        }));
+
+        report(measure("lower: construct tree", iterations, [&] {
+            lowerModule(module, false);
+        }));
+
+        // Includes linearization of every body.
+        report(measure("lower: linear body", iterations, [&] {
+            lowerModule(module, true);
+        }));
+    }
+}
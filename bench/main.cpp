@@ -0,0 +1,22 @@
+#include <iostream>
+#include <string>
+#include "bench.h"
+
+/**
+ * Runs all registered benchmarks, or only those whose name contains
+ * the filter provided as the first argument.
+ */
+int main(int argc, char** argv) {
+    std::string filter = argc > 1 ? argv[1] : "";
+
+    for (const auto& benchmark : ionlang::bench::getBenchmarks()) {
+        if (benchmark.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        std::cout << "[" << benchmark.name << "]" << std::endl;
+        benchmark.callback();
+    }
+
+    return 0;
+}
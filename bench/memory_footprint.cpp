@@ -0,0 +1,49 @@
+#include <iostream>
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/tracking/memory_tracker.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    /**
+     * Dump the memory footprint after constructing and after lowering a
+     * synthetic module, then after lowering another one in streaming
+     * mode, which releases each function's body once lowered. Requires
+     * IONLANG_MEMORY_TRACKING, otherwise all counters are reported as
+     * zero.
+     */
+    IONLANG_BENCHMARK(memoryFootprint) {
+        MemoryTracker::beginPhase();
+
+        std::shared_ptr<Module> module = fixture::syntheticModule(500, 64);
+
+        MemoryTracker::writeJson(std::cout, "construction");
+        std::cout << std::endl;
+        MemoryTracker::beginPhase();
+
+        IonIrLoweringPass irLoweringPass{std::make_shared<ionshared::PassContext>()};
+
+        irLoweringPass.visitModule(module);
+        MemoryTracker::writeJson(std::cout, "lowering");
+        std::cout << std::endl;
+
+        std::shared_ptr<Module> streamedModule = fixture::syntheticModule(500, 64);
+
+        MemoryTracker::beginPhase();
+
+        IonIrLoweringPass streamingIrLoweringPass{
+            std::make_shared<ionshared::PassContext>(),
+            std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>(),
+
+            LoweringOptions{
+                .functionSink = [](const std::shared_ptr<Function>&, const std::shared_ptr<ionir::Function>& irFunction) {
+                    doNotOptimize(irFunction);
+                }
+            }
+        };
+
+        streamingIrLoweringPass.visitModule(streamedModule);
+        MemoryTracker::writeJson(std::cout, "streaming lowering");
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,83 @@
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t functionCount = 100;
+
+    static constexpr size_t depth = 32;
+
+    static constexpr size_t localCount = 8;
+
+    static constexpr size_t iterations = 10;
+
+    /**
+     * Resolve variable references the way name resolution used to: by
+     * walking the symbol tables of the enclosing scopes outwards from
+     * the reference's block, for every reference.
+     */
+    static void resolveByScopeChain(const std::shared_ptr<Construct>& construct) {
+        if (construct->constructKind == ConstructKind::Resolvable) {
+            PtrResolvable<> resolvable = construct->staticCast<Resolvable<>>();
+
+            if (!resolvable->isResolved()
+                && *resolvable->resolvableKind == ResolvableKind::VariableLike) {
+                std::string name = ***resolvable->id;
+
+                ionshared::OptPtr<ScopedConstruct> scope =
+                    (*resolvable->findContext())->staticCast<ScopedConstruct>();
+
+                while (ionshared::util::hasValue(scope)) {
+                    ionshared::OptPtr<Construct> symbolResult =
+                        scope->get()->symbolTable.lookup(name);
+
+                    if (ionshared::util::hasValue(symbolResult)) {
+                        resolvable->resolve(*symbolResult);
+
+                        break;
+                    }
+
+                    scope = scope->get()->findEnclosingScope();
+                }
+            }
+        }
+
+        for (const auto& child : construct->getChildNodes()) {
+            resolveByScopeChain(child);
+        }
+    }
+
+    /**
+     * Compare resolving references to outer locals from deeply nested
+     * blocks by walking the scope chain, and in a single walk over the
+     * scope stack. References resolve once, so each iteration (and the
+     * warm up) is handed a fresh module.
+     */
+    IONLANG_BENCHMARK(nameResolution) {
+        auto makeModules = [] {
+            std::vector<std::shared_ptr<Module>> modules{};
+
+            for (size_t i = 0; i <= iterations; i++) {
+                modules.push_back(fixture::nestedModule(functionCount, depth, localCount));
+            }
+
+            return modules;
+        };
+
+        std::vector<std::shared_ptr<Module>> modules = makeModules();
+        size_t moduleIndex = 0;
+
+        report(measure("name resolution: scope chain walk", iterations, [&] {
+            resolveByScopeChain(modules[moduleIndex++]);
+        }));
+
+        modules = makeModules();
+        moduleIndex = 0;
+
+        report(measure("name resolution: scope stack", iterations, [&] {
+            NameResolutionPass nameResolutionPass{std::make_shared<ionshared::PassContext>()};
+
+            nameResolutionPass.visit(modules[moduleIndex++]);
+        }));
+    }
+}
@@ -0,0 +1,98 @@
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include "bench.h"
+
+namespace ionlang::bench {
+    static constexpr size_t iterations = 20;
+
+    // Nodes per module, split between expression and block nesting.
+    static constexpr size_t nodeCount = 16'384;
+
+    static void appendStatement(
+        const std::shared_ptr<Block>& block,
+        const std::shared_ptr<Statement>& statement
+    ) {
+        statement->setParent(block);
+        block->appendStatement(statement);
+    }
+
+    /**
+     * Create a module whose functions each declare a local initialized
+     * by a chain of additions nested to the provided depth, followed by
+     * if statements whose consequent blocks are nested to the same depth.
+     * The total amount of nodes is the same regardless of the depth.
+     */
+    static std::shared_ptr<Module> deeplyNestedModule(size_t depth) {
+        std::shared_ptr<Module> module = std::make_shared<Module>("bench");
+        size_t functionCount = nodeCount / depth / 2;
+
+        for (size_t i = 0; i < functionCount; i++) {
+            std::string functionName = "function_" + std::to_string(i);
+
+            std::shared_ptr<Function> function = Function::make(
+                Prototype::make(
+                    functionName,
+                    ArgumentList::make(),
+                    Resolvable<Type>::make(type_factory::typeVoid())
+                ),
+
+                Block::make()
+            );
+
+            function->setParent(module);
+            module->context->globalScope.set(functionName, function);
+
+            std::shared_ptr<Expression<>> value =
+                IntegerLiteral::make(type_factory::typeInteger32(), 1)->flattenExpression();
+
+            for (size_t level = 0; level < depth; level++) {
+                value = OperationExpr::make(
+                    Resolvable<Type>::make(type_factory::typeInteger32()),
+                    IntrinsicOperatorKind::Addition,
+                    value,
+                    IntegerLiteral::make(type_factory::typeInteger32(), 1)->flattenExpression()
+                )->flattenExpression();
+            }
+
+            appendStatement(function->body, VariableDeclStmt::make(
+                Resolvable<Type>::make(type_factory::typeInteger32()),
+                "nested",
+                value
+            ));
+
+            // Each if statement is the last of its block, so lowering never splits a block.
+            std::shared_ptr<Block> block = function->body;
+
+            for (size_t level = 0; level < depth; level++) {
+                std::shared_ptr<Block> consequentBlock = Block::make();
+
+                appendStatement(block, IfStmt::make(
+                    std::make_shared<BooleanLiteral>(true),
+                    consequentBlock
+                ));
+
+                block = consequentBlock;
+            }
+        }
+
+        return module;
+    }
+
+    /**
+     * Lower modules of the same size nested to increasing depths. Buffers
+     * are checkpointed by their heights rather than copied, so the time
+     * per module should remain flat as the depth grows.
+     */
+    IONLANG_BENCHMARK(nestedLowering) {
+        for (size_t depth : {4, 16, 64, 256}) {
+            std::shared_ptr<Module> module = deeplyNestedModule(depth);
+
+            report(measure("lower: depth " + std::to_string(depth), iterations, [&] {
+                IonIrLoweringPass irLoweringPass{std::make_shared<ionshared::PassContext>()};
+
+                irLoweringPass.visitModule(module);
+                doNotOptimize(irLoweringPass.getModules());
+            }));
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t functionCount = 2000;
+
+    static constexpr size_t statementCount = 64;
+
+    static constexpr size_t iterations = 20;
+
+    /**
+     * Lower the same module with pools of increasing thread counts, and
+     * print the speedup over a single thread, which lowers serially.
+     */
+    IONLANG_BENCHMARK(parallelLowering) {
+        std::shared_ptr<Module> module =
+            fixture::syntheticModule(functionCount, statementCount);
+
+        size_t maxThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        std::vector<size_t> threadCounts{};
+
+        // Powers of two, always including the exact hardware thread count.
+        for (size_t threadCount = 1; threadCount < maxThreadCount; threadCount *= 2) {
+            threadCounts.push_back(threadCount);
+        }
+
+        threadCounts.push_back(maxThreadCount);
+
+        std::optional<double> baselineNanoseconds = std::nullopt;
+
+        for (size_t threadCount : threadCounts) {
+            std::shared_ptr<WorkStealingPool> workStealingPool =
+                std::make_shared<WorkStealingPool>(threadCount);
+
+            Measurement measurement = measure(
+                "lower: " + std::to_string(threadCount) + " thread(s)",
+                iterations,
+                [&] {
+                    IonIrLoweringPass irLoweringPass{
+                        std::make_shared<ionshared::PassContext>(),
+                        std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>(),
+
+                        LoweringOptions{.workStealingPool = workStealingPool}
+                    };
+
+                    irLoweringPass.visitModule(module);
+                    doNotOptimize(irLoweringPass.getModules());
+                }
+            );
+
+            if (!baselineNanoseconds.has_value()) {
+                baselineNanoseconds = measurement.nanosecondsPerIteration;
+            }
+
+            report(measurement);
+
+            std::cout << std::left << std::setw(48) << "  speedup"
+                << std::right << std::setw(14) << std::fixed << std::setprecision(2)
+                << *baselineNanoseconds / measurement.nanosecondsPerIteration << " x"
+                << std::endl;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <ionlang/passes/parallel_pass_manager.h>
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t functionCount = 2000;
+
+    static constexpr size_t statementCount = 64;
+
+    static constexpr size_t iterations = 20;
+
+    IONLANG_BENCHMARK(parallelPassManager) {
+        std::shared_ptr<Module> module =
+            fixture::syntheticModule(functionCount, statementCount);
+
+        std::shared_ptr<ionshared::PassContext> passContext =
+            std::make_shared<ionshared::PassContext>();
+
+        size_t maxThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        std::vector<size_t> threadCounts{};
+
+        // Powers of two, always including the exact hardware thread count.
+        for (size_t threadCount = 1; threadCount < maxThreadCount; threadCount *= 2) {
+            threadCounts.push_back(threadCount);
+        }
+
+        threadCounts.push_back(maxThreadCount);
+
+        std::optional<double> baselineNanoseconds = std::nullopt;
+
+        for (size_t threadCount : threadCounts) {
+            ParallelPassManager passManager{threadCount};
+
+            passManager.registerFunctionPass([](std::shared_ptr<ionshared::PassContext> context) {
+                return std::make_shared<NameResolutionPass>(std::move(context));
+            });
+
+            Measurement measurement = measure(
+                "name resolution: " + std::to_string(threadCount) + " thread(s)",
+                iterations,
+                [&] {
+                    passManager.run(module, passContext);
+                }
+            );
+
+            if (!baselineNanoseconds.has_value()) {
+                baselineNanoseconds = measurement.nanosecondsPerIteration;
+            }
+
+            report(measurement);
+
+            std::cout << std::left << std::setw(48) << "  speedup"
+                << std::right << std::setw(14) << std::fixed << std::setprecision(2)
+                << *baselineNanoseconds / measurement.nanosecondsPerIteration << " x"
+                << std::endl;
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#include <ionlang/passes/static_pass.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t iterations = 20;
+
+    /**
+     * Dispatches the way passes used to: a virtual accept call on the
+     * construct, which then calls the virtual visit method.
+     */
+    struct AcceptCountingPass : Pass {
+        size_t count = 0;
+
+        AcceptCountingPass() :
+            Pass(std::make_shared<ionshared::PassContext>()) {
+            //
+        }
+
+        void visit(std::shared_ptr<Construct> construct) override {
+            if (construct->constructKind == ConstructKind::Resolvable) {
+                this->visitResolvable(construct->staticCast<Resolvable<>>());
+            }
+            else {
+                construct->accept(*this);
+            }
+
+            this->visitChildren(construct);
+        }
+
+        void visitVariableRefExpr(std::shared_ptr<VariableRefExpr> construct) override {
+            this->count++;
+        }
+    };
+
+    struct CountingPass : Pass {
+        size_t count = 0;
+
+        CountingPass() :
+            Pass(std::make_shared<ionshared::PassContext>()) {
+            //
+        }
+
+        void visitVariableRefExpr(std::shared_ptr<VariableRefExpr> construct) override {
+            this->count++;
+        }
+    };
+
+    struct CountingStaticPass : StaticPass<CountingStaticPass> {
+        size_t count = 0;
+
+        void visitVariableRefExpr(const std::shared_ptr<VariableRefExpr>& construct) {
+            this->count++;
+        }
+    };
+
+    /**
+     * Compare the cost of traversing a synthetic module with a pass
+     * which only counts variable references, through each dispatch
+     * mechanism.
+     */
+    IONLANG_BENCHMARK(passDispatch) {
+        std::shared_ptr<Module> module = fixture::syntheticModule(2000, 64);
+
+        report(measure("traversal: accept() double dispatch", iterations, [&] {
+            AcceptCountingPass pass{};
+
+            pass.visit(module);
+        }));
+
+        report(measure("traversal: switch, virtual visit", iterations, [&] {
+            CountingPass pass{};
+
+            pass.visit(module);
+        }));
+
+        report(measure("traversal: switch, static visit", iterations, [&] {
+            CountingStaticPass pass{};
+
+            pass.visit(module);
+        }));
+    }
+}
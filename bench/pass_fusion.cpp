@@ -0,0 +1,62 @@
+#include <ionlang/passes/parallel_pass_manager.h>
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t passCount = 4;
+
+    static constexpr size_t iterations = 20;
+
+    /**
+     * Stands in for a checker: inspects each variable reference.
+     */
+    struct ReferenceCheckPass : Pass {
+        size_t unresolvedCount = 0;
+
+        explicit ReferenceCheckPass(std::shared_ptr<ionshared::PassContext> context) :
+            Pass(std::move(context)) {
+            //
+        }
+
+        void visitVariableRefExpr(std::shared_ptr<VariableRefExpr> construct) override {
+            if (!construct->variableDecl->isResolved()) {
+                this->unresolvedCount++;
+            }
+        }
+    };
+
+    /**
+     * Compare running name resolution followed by several checks as
+     * separate traversals, and fused into a single traversal. A single
+     * thread is used, so that only the traversal cost differs.
+     */
+    IONLANG_BENCHMARK(passFusion) {
+        std::shared_ptr<Module> module = fixture::syntheticModule(2000, 64);
+
+        std::shared_ptr<ionshared::PassContext> passContext =
+            std::make_shared<ionshared::PassContext>();
+
+        for (bool isFusible : {false, true}) {
+            ParallelPassManager passManager{1};
+
+            passManager.registerFunctionPass([](std::shared_ptr<ionshared::PassContext> context) {
+                return std::make_shared<NameResolutionPass>(std::move(context));
+            }, "name resolution", PassSchedule{isFusible});
+
+            for (size_t i = 0; i < passCount; i++) {
+                passManager.registerFunctionPass([](std::shared_ptr<ionshared::PassContext> context) {
+                    return std::make_shared<ReferenceCheckPass>(std::move(context));
+                }, "check " + std::to_string(i), PassSchedule{isFusible, {"name resolution"}});
+            }
+
+            std::string name = isFusible
+                ? "name resolution + checks: fused"
+                : "name resolution + checks: separate";
+
+            report(measure(name, iterations, [&] {
+                passManager.run(module, passContext);
+            }));
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#include <fstream>
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/tracking/trace_recorder.h>
+#include "bench.h"
+#include "fixture.h"
+
+namespace ionlang::bench {
+    static constexpr size_t iterations = 20;
+
+    /**
+     * Compare lowering a synthetic module with tracing disabled and
+     * enabled, and write the trace of the last run to trace.json.
+     */
+    IONLANG_BENCHMARK(traceRecorder) {
+        std::shared_ptr<Module> module = fixture::syntheticModule(2000, 64);
+
+        auto lower = [&] {
+            IonIrLoweringPass irLoweringPass{std::make_shared<ionshared::PassContext>()};
+
+            irLoweringPass.visitModule(module);
+        };
+
+        report(measure("lowering: tracing disabled", iterations, lower));
+        TraceRecorder::setEnabled(true);
+
+        report(measure("lowering: tracing enabled", iterations, [&] {
+            TraceRecorder::reset();
+            lower();
+        }));
+
+        TraceRecorder::setEnabled(false);
+
+        std::ofstream stream{"trace.json"};
+
+        TraceRecorder::writeJson(stream);
+        TraceRecorder::reset();
+    }
+}
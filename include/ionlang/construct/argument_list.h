@@ -3,24 +3,19 @@
 #include <utility>
 #include <string>
 #include <ionshared/misc/helpers.h>
-#include <ionshared/tracking/symbol_table.h>
 #include <ionlang/construct/type.h>
 
 namespace ionlang {
     struct ArgumentList : ScopedConstruct {
         static std::shared_ptr<ArgumentList> make(
-            const ionshared::PtrSymbolTable<Construct>& symbolTable =
-                ionshared::util::makePtrSymbolTable<Construct>(),
-
+            ScopeTable<Construct> symbolTable = {},
             bool isVariable = false
         ) noexcept;
 
         bool isVariable;
 
         explicit ArgumentList(
-            const ionshared::PtrSymbolTable<Construct>& symbolTable =
-                ionshared::util::makePtrSymbolTable<Construct>(),
-
+            ScopeTable<Construct> symbolTable = {},
             bool isVariable = false
         );
 
@@ -3,8 +3,6 @@
 #include <string>
 #include <ionshared/misc/named.h>
 #include <ionshared/misc/helpers.h>
-#include <ionshared/tracking/symbol_table.h>
-#include <ionshared/tracking/scoped.h>
 #include <ionlang/construct/construct.h>
 #include "module.h"
 
@@ -21,9 +19,7 @@ namespace ionlang {
     struct Block : ScopedConstruct {
         static std::shared_ptr<Block> make(
             const std::vector<std::shared_ptr<Statement>>& statements = {},
-
-            const ionshared::PtrSymbolTable<Construct>& symbolTable =
-            ionshared::util::makePtrSymbolTable<Construct>()
+            ScopeTable<Construct> symbolTable = {}
         ) noexcept;
 
         // TODO: When statements are mutated, the symbol table must be cleared and re-populated.
@@ -31,9 +27,7 @@ namespace ionlang {
 
         explicit Block(
             std::vector<std::shared_ptr<Statement>> statements = {},
-
-            const ionshared::PtrSymbolTable<Construct>& symbolTable =
-                ionshared::util::makePtrSymbolTable<Construct>()
+            ScopeTable<Construct> symbolTable = {}
         );
 
         void accept(Pass& visitor) override;
@@ -50,8 +44,9 @@ namespace ionlang {
 
         /**
          * Move the statement at the provided order index from this block
-         * to another. The statement will be removed from the local vector,
-         * and registered on the target block's symbol table.
+         * to another. The statement will be removed from the local vector
+         * and symbol table, registered on the target block's symbol table,
+         * and re-parented to the target block.
          */
         bool relocateStatement(size_t orderIndex, const std::shared_ptr<Block>& target);
 
@@ -61,6 +56,24 @@ namespace ionlang {
             std::optional<size_t> to = std::nullopt
         );
 
+        /**
+         * Remove the statements within the provided range (or all after
+         * the starting index if no end index was provided), unregistering
+         * them from the local symbol table. Returns the amount of
+         * statements removed.
+         */
+        size_t eraseStatements(size_t from, std::optional<size_t> to = std::nullopt);
+
+        /**
+         * Insert statements before the provided order index, registering
+         * them on the local symbol table and re-parenting them to this
+         * block.
+         */
+        void insertStatements(
+            size_t orderIndex,
+            const std::vector<std::shared_ptr<Statement>>& statements
+        );
+
         /**
          * Splits the local basic block, relocating all instructions
          * within the provided range (or all after the starting index if
@@ -92,6 +105,6 @@ namespace ionlang {
 
         [[nodiscard]] ionshared::OptPtr<Statement> findLastStatement() noexcept;
 
-        [[nodiscard]] ionshared::OptPtr<Function> findParentFunction();
+        [[nodiscard]] ionshared::OptPtr<Function> findParentFunction() const noexcept;
     };
 }
@@ -1,9 +1,12 @@
 #pragma once
 
-#include <ionshared/tracking/scoped.h>
+#include <atomic>
 #include <ionshared/tracking/symbol_table.h>
 #include <ionshared/construct/base_construct.h>
 #include <ionshared/diagnostics/source_location.h>
+#include <ionlang/tracking/concurrent_scope_table.h>
+#include <ionlang/tracking/memory_tracker.h>
+#include <ionlang/tracking/scope_table.h>
 
 namespace ionlang {
     enum struct ConstructKind : uint32_t {
@@ -44,12 +47,43 @@ namespace ionlang {
         Method
     };
 
+    /**
+     * Identifies a construct, for the lifetime of the process. IDs are
+     * handed out sequentially upon creation and never reused, so tables
+     * annotating constructs can be flat arrays indexed by ID. IDs are
+     * 64 bits wide, so that the counter cannot wrap around in a long
+     * running process.
+     */
+    typedef uint64_t ConstructId;
+
     struct Construct;
 
+    struct ScopedConstruct;
+
+    struct Function;
+
+    struct Module;
+
     struct Pass;
 
     typedef ionshared::Ast<Construct> Ast;
 
+    /**
+     * Non-owning links to the nearest enclosing scope, function and
+     * module of a construct. These are computed once the construct is
+     * attached to a parent, so that lookups do not need to walk the
+     * parent chain.
+     */
+    struct EnclosingConstructs {
+        std::weak_ptr<ScopedConstruct> scope;
+
+        std::weak_ptr<Function> function;
+
+        std::weak_ptr<Module> module;
+
+        [[nodiscard]] bool isSameAs(const EnclosingConstructs& other) const noexcept;
+    };
+
     struct Construct : ionshared::BaseConstruct<Construct, ConstructKind> {
         template<class T>
         static Ast convertChildren(std::vector<std::shared_ptr<T>> vector) {
@@ -75,6 +109,33 @@ namespace ionlang {
             return children;
         }
 
+        template<class T>
+        static Ast convertChildren(const ScopeTable<T>& scopeTable) {
+            Ast children = {};
+
+            children.reserve(scopeTable.getSize());
+
+            for (const auto& [name, construct] : scopeTable) {
+                children.push_back(construct);
+            }
+
+            return children;
+        }
+
+        template<class T>
+        static Ast convertChildren(const ConcurrentScopeTable<T>& scopeTable) {
+            Ast children = {};
+            std::vector<typename ConcurrentScopeTable<T>::Entry> entries = scopeTable.getEntries();
+
+            children.reserve(entries.size());
+
+            for (auto& [name, construct] : entries) {
+                children.push_back(std::move(construct));
+            }
+
+            return children;
+        }
+
         template<typename TFirst, typename TSecond>
         static Ast mergeChildren(TFirst first, TSecond second) {
             Ast children = {};
@@ -112,14 +173,52 @@ namespace ionlang {
             return construct;
         }
 
+        /**
+         * The amount of IDs handed out so far, which is one more than
+         * the latest construct's ID.
+         */
+        [[nodiscard]] static ConstructId getConstructIdCount() noexcept;
+
+        const ConstructId constructId;
+
         explicit Construct(
             ConstructKind kind,
             std::optional<ionshared::SourceLocation> sourceLocation = std::nullopt,
             ionshared::OptPtr<Construct> parent = std::nullopt
         );
 
+#ifdef IONLANG_MEMORY_TRACKING
+        ~Construct() override;
+#endif
+
         virtual void accept(Pass& visitor) = 0;
 
+        /**
+         * Set the parent and update the cached enclosing constructs
+         * of this construct and, if they changed, of its children. The
+         * parent link is non-owning: children never keep their parents
+         * alive, which keeps the tree free of reference cycles.
+         */
+        void setParent(std::optional<std::shared_ptr<Construct>> parent) noexcept override;
+
+        /**
+         * Retrieve the parent, if any and if it's still alive.
+         */
+        [[nodiscard]] ionshared::OptPtr<Construct> getParent() const noexcept;
+
+        [[nodiscard]] std::shared_ptr<Construct> forceGetParent() const;
+
+        [[nodiscard]] bool isRootNode() const noexcept;
+
+        /**
+         * Re-compute the cached enclosing constructs from the parent's,
+         * propagating to children if the result differs from the
+         * previously cached links.
+         */
+        virtual void refreshEnclosingConstructs() noexcept;
+
+        [[nodiscard]] virtual bool isScope() const noexcept;
+
         [[nodiscard]] virtual Ast getChildNodes();
 
         /**
@@ -131,11 +230,60 @@ namespace ionlang {
         [[nodiscard]] virtual bool verify();
 
         [[nodiscard]] std::optional<std::string> findConstructName();
+
+        /**
+         * Find the nearest scoped ancestor of this construct,
+         * excluding itself.
+         */
+        [[nodiscard]] ionshared::OptPtr<ScopedConstruct> findEnclosingScope() const noexcept;
+
+        [[nodiscard]] ionshared::OptPtr<Function> findEnclosingFunction() const noexcept;
+
+        [[nodiscard]] ionshared::OptPtr<Module> findEnclosingModule() const noexcept;
+
+    protected:
+        /**
+         * Account this construct under a more specific subject, such as
+         * its statement kind. Must be invoked once, by the constructor of
+         * the corresponding base.
+         */
+#ifdef IONLANG_MEMORY_TRACKING
+        void trackMemorySubject(MemorySubject subject, uint32_t kind) noexcept;
+#else
+        void trackMemorySubject(MemorySubject, uint32_t) noexcept {
+            //
+        }
+#endif
+
+    private:
+        static std::atomic<ConstructId> nextConstructId;
+
+        std::weak_ptr<Construct> weakParent;
+
+        EnclosingConstructs enclosingConstructs;
+
+#ifdef IONLANG_MEMORY_TRACKING
+        // The refined subject and kind this construct is accounted under, if any.
+        MemorySubject memorySubject = MemorySubject::Construct;
+
+        uint32_t memoryKind = 0;
+#endif
     };
 
-    typedef ionshared::Scoped<Construct, ConstructKind> Scoped;
+    /**
+     * A construct which introduces a lexical scope, along with
+     * the symbol table of the names declared directly within it.
+     */
+    struct ScopedConstruct : Construct {
+        ScopeTable<Construct> symbolTable;
 
-    struct ScopedConstruct : virtual Construct, virtual Scoped {
-        void setParent(std::optional<std::shared_ptr<Construct>> parent) noexcept override;
+        explicit ScopedConstruct(
+            ConstructKind kind,
+            ScopeTable<Construct> symbolTable = {}
+        );
+
+        [[nodiscard]] bool isScope() const noexcept override;
     };
+
+    typedef ScopedConstruct Scoped;
 }
@@ -37,7 +37,7 @@ namespace ionlang {
             Construct(ConstructKind::Expression),
             expressionKind(kind),
             type(std::move(type)) {
-            //
+            this->trackMemorySubject(MemorySubject::Expression, static_cast<uint32_t>(kind));
         }
 
         Expression(ExpressionKind kind, std::shared_ptr<T> type) noexcept :
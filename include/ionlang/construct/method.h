@@ -31,7 +31,10 @@ namespace ionlang {
 
         const MethodKind methodKind;
 
-        std::shared_ptr<StructType> structType;
+        /**
+         * Non-owning, since the struct type owns its methods.
+         */
+        std::weak_ptr<StructType> structType;
 
         std::shared_ptr<Prototype> prototype;
 
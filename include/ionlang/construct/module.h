@@ -1,16 +1,22 @@
 #pragma once
 
 #include <ionshared/misc/named.h>
-#include <ionshared/tracking/scoped.h>
-#include <ionshared/tracking/context.h>
 #include "construct.h"
 
 namespace ionlang {
     struct Pass;
 
-//    typedef ionshared::Scope<Construct> Scope;
+    struct Context {
+        typedef ConcurrentScopeTable<Construct> Scope;
 
-    typedef ionshared::Context<Construct> Context;
+        /**
+         * Top-level constructs of the module. May be read while other
+         * workers register constructs on it.
+         */
+        Scope globalScope;
+
+        explicit Context(Scope globalScope = {}) noexcept;
+    };
 
     struct Module : Construct, ionshared::Named {
         std::shared_ptr<Context> context;
@@ -20,6 +26,13 @@ namespace ionlang {
             std::shared_ptr<Context> context = std::make_shared<Context>()
         );
 
+        /**
+         * Hands the module's context over to the global AST reclaimer,
+         * so that its constructs are released without recursion (and
+         * off the calling thread, in background mode).
+         */
+        ~Module() override;
+
         void accept(Pass& visitor) override;
 
         [[nodiscard]] Ast getChildNodes() override;
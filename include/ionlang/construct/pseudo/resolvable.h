@@ -36,6 +36,12 @@ namespace ionlang {
      * to be resolved. Resolution can only occur once, and attempts
      * to re-resolve a value will be denied but no exception will
      * be thrown.
+     *
+     * A value which has no parent of its own (such as a type created
+     * for this resolvable) is owned by the resolvable. A value which
+     * already belongs somewhere else in the tree (such as a variable
+     * declaration or a function) is only referenced, and is not kept
+     * alive by the resolvable.
      */
     template<typename T = Construct>
         requires std::derived_from<T, Construct>
@@ -43,7 +49,15 @@ namespace ionlang {
     private:
         ionshared::OptPtr<T> value;
 
-        ionshared::OptPtr<Construct> cachedParent;
+        std::weak_ptr<T> referencedValue;
+
+        std::weak_ptr<Construct> cachedParent;
+
+        std::weak_ptr<Construct> weakContext;
+
+        [[nodiscard]] bool isValueOwned() const noexcept {
+            return ionshared::util::hasValue(this->value);
+        }
 
     public:
         [[nodiscard]] static std::shared_ptr<Resolvable<T>> make(
@@ -66,28 +80,29 @@ namespace ionlang {
         // TODO: Should the identifier be a child?
         const std::optional<std::shared_ptr<Identifier>> id;
 
-        const ionshared::OptPtr<Construct> context;
-
         Resolvable(
             ResolvableKind kind,
             std::shared_ptr<Identifier> id,
             std::shared_ptr<Construct> context // TODO: Change type to Scope (or Context for deeper lookup?).
         ) noexcept :
             Construct(ConstructKind::Resolvable),
-            resolvableKind(kind),
-            id(std::move(id)),
-            context(std::move(context)),
             value(std::nullopt),
-            cachedParent(std::nullopt) {
+            referencedValue(),
+            cachedParent(),
+            weakContext(context),
+            resolvableKind(kind),
+            id(std::move(id)) {
             //
         }
 
         explicit Resolvable(std::shared_ptr<T> value) noexcept :
             Construct(ConstructKind::Resolvable),
+            value(value),
+            referencedValue(),
+            cachedParent(),
+            weakContext(),
             resolvableKind(std::nullopt),
-            id(std::nullopt),
-            context(std::nullopt),
-            value(value) {
+            id(std::nullopt) {
             //
         }
 
@@ -99,16 +114,44 @@ namespace ionlang {
 
         /**
          * Cache a parent construct to be applied once the resolvable
-         * is resolved, or if it is already resolved, apply it to the
-         * value immediately. Will also update the resolvable's parent.
+         * is resolved, or if it is already resolved to a value it owns,
+         * apply it to the value immediately. Will also update the
+         * resolvable's parent.
          */
         void setParent(std::optional<std::shared_ptr<Construct>> parent) noexcept override {
-            if (this->isResolved()) {
+            if (this->isValueOwned()) {
                 this->value->get()->setParent(parent);
             }
 
-            BaseConstruct::setParent(parent);
-            this->cachedParent = parent;
+            Construct::setParent(parent);
+
+            this->cachedParent = ionshared::util::hasValue(parent)
+                ? std::weak_ptr<Construct>(*parent)
+                : std::weak_ptr<Construct>();
+        }
+
+        /**
+         * An owned value shares the resolvable's parent, so its cached
+         * enclosing constructs must be kept in sync as well.
+         */
+        void refreshEnclosingConstructs() noexcept override {
+            Construct::refreshEnclosingConstructs();
+
+            if (this->isValueOwned()) {
+                this->value->get()->refreshEnclosingConstructs();
+            }
+        }
+
+        /**
+         * The construct in which name lookup begins, if the resolvable
+         * was created by name and the construct is still alive.
+         */
+        [[nodiscard]] ionshared::OptPtr<Construct> findContext() const noexcept {
+            if (std::shared_ptr<Construct> context = this->weakContext.lock()) {
+                return context;
+            }
+
+            return std::nullopt;
         }
 
         [[nodiscard]] std::shared_ptr<T> operator*() {
@@ -116,35 +159,52 @@ namespace ionlang {
                 throw std::runtime_error("Value is not resolved but being accessed");
             }
 
-            return *this->value;
+            return *this->getValue();
         }
 
         Resolvable<T>& operator=(std::shared_ptr<T> value) {
             this->resolve(value);
+
+            return *this;
         }
 
         ionshared::OptPtr<T> getValue() const noexcept {
-            return this->value;
+            if (this->isValueOwned()) {
+                return this->value;
+            }
+            else if (std::shared_ptr<T> referencedValue = this->referencedValue.lock()) {
+                return referencedValue;
+            }
+
+            return std::nullopt;
         }
 
         [[nodiscard]] std::shared_ptr<T> forceGetValue() const {
-            if (!ionshared::util::hasValue(this->value)) {
+            ionshared::OptPtr<T> value = this->getValue();
+
+            if (!ionshared::util::hasValue(value)) {
                 throw std::runtime_error("Value is not set or nullptr");
             }
 
-            return *this->value;
+            return *value;
         }
 
         template<typename TValue>
         [[nodiscard]] ionshared::OptPtr<TValue> getValueAs() const {
             // TODO: Ensure T is or derives from Construct.
-            return this->isResolved()
-                ? std::dynamic_pointer_cast<TValue>(this->getValue()->get())
+            ionshared::OptPtr<T> value = this->getValue();
+
+            return ionshared::util::hasValue(value)
+                ? ionshared::OptPtr<TValue>(std::dynamic_pointer_cast<TValue>(*value))
                 : std::nullopt;
         }
 
-        [[nodiscard]] bool isResolved() noexcept {
-            return ionshared::util::hasValue(this->value);
+        /**
+         * Whether the resolvable holds a value. A referenced value which
+         * has since been released no longer counts as resolved.
+         */
+        [[nodiscard]] bool isResolved() const noexcept {
+            return this->isValueOwned() || !this->referencedValue.expired();
         }
 
         /**
@@ -157,10 +217,22 @@ namespace ionlang {
                 return false;
             }
 
+            /**
+             * A value which already has a parent belongs to another part
+             * of the tree, and is only referenced. Owning it would either
+             * re-parent it, or create a reference cycle for recursive
+             * constructs (a function calling itself, for example).
+             */
+            if (!value->isRootNode()) {
+                this->referencedValue = value;
+
+                return true;
+            }
+
             this->value = value;
 
-            if (ionshared::util::hasValue(this->cachedParent)) {
-                value->setParent(*this->cachedParent);
+            if (std::shared_ptr<Construct> cachedParent = this->cachedParent.lock()) {
+                value->setParent(cachedParent);
             }
 
             return true;
@@ -1,20 +1,25 @@
 #pragma once
 
-#include <ionshared/container/set.h>
+#include <cstdint>
+#include <stdexcept>
 #include <ionshared/misc/named.h>
 #include "construct.h"
 
 namespace ionlang {
-    enum struct TypeQualifier {
-        Constant,
+    /**
+     * Each qualifier occupies a single bit, allowing a full set of
+     * qualifiers to be stored inline on a type as a flag set.
+     */
+    enum struct TypeQualifier : uint8_t {
+        Constant = 1 << 0,
 
-        Mutable,
+        Mutable = 1 << 1,
 
-        Reference,
+        Reference = 1 << 2,
 
-        Pointer,
+        Pointer = 1 << 3,
 
-        Nullable
+        Nullable = 1 << 4
     };
 
     enum struct TypeKind : uint32_t {
@@ -29,21 +34,114 @@ namespace ionlang {
         Boolean
     };
 
-    typedef ionshared::Set<TypeQualifier> TypeQualifierSet;
+    /**
+     * An inline set of type qualifiers. Since nested pointers cannot
+     * be expressed with a single flag, the pointer depth is stored
+     * alongside the flags. The pointer flag is set if and only if the
+     * pointer depth is non-zero.
+     */
+    class TypeQualifiers {
+    private:
+        uint8_t flags;
+
+        uint8_t pointerDepth;
+
+    public:
+        static constexpr size_t qualifierCount = 5;
+
+        /**
+         * Number of distinct qualifier flag combinations.
+         */
+        static constexpr size_t combinationCount = 1 << TypeQualifiers::qualifierCount;
+
+        constexpr TypeQualifiers() noexcept :
+            flags(0),
+            pointerDepth(0) {
+            //
+        }
+
+        [[nodiscard]] constexpr bool has(TypeQualifier qualifier) const noexcept {
+            return (this->flags & static_cast<uint8_t>(qualifier)) != 0;
+        }
+
+        /**
+         * Add a qualifier. Adding the pointer qualifier to a non-pointer
+         * type results in a pointer depth of one.
+         */
+        constexpr TypeQualifiers& add(TypeQualifier qualifier) noexcept {
+            if (qualifier == TypeQualifier::Pointer && this->pointerDepth == 0) {
+                this->pointerDepth = 1;
+            }
+
+            this->flags |= static_cast<uint8_t>(qualifier);
+
+            return *this;
+        }
+
+        constexpr TypeQualifiers& remove(TypeQualifier qualifier) noexcept {
+            if (qualifier == TypeQualifier::Pointer) {
+                this->pointerDepth = 0;
+            }
+
+            this->flags &= ~static_cast<uint8_t>(qualifier);
+
+            return *this;
+        }
+
+        /**
+         * Add a level of pointer indirection.
+         */
+        TypeQualifiers& addPointer() {
+            if (this->pointerDepth == UINT8_MAX) {
+                throw std::runtime_error("Maximum pointer depth exceeded");
+            }
+
+            this->pointerDepth++;
+            this->flags |= static_cast<uint8_t>(TypeQualifier::Pointer);
+
+            return *this;
+        }
+
+        /**
+         * Merge the provided qualifiers into this set. Pointer depths
+         * are not added together; the deepest one is kept.
+         */
+        constexpr TypeQualifiers& merge(const TypeQualifiers& other) noexcept {
+            this->flags |= other.flags;
+
+            if (other.pointerDepth > this->pointerDepth) {
+                this->pointerDepth = other.pointerDepth;
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] constexpr uint8_t getFlags() const noexcept {
+            return this->flags;
+        }
+
+        [[nodiscard]] constexpr uint8_t getPointerDepth() const noexcept {
+            return this->pointerDepth;
+        }
+
+        [[nodiscard]] constexpr bool isEmpty() const noexcept {
+            return this->flags == 0;
+        }
+
+        constexpr bool operator==(const TypeQualifiers& other) const noexcept = default;
+    };
 
     struct Type : Construct {
         const std::string typeName;
 
         const TypeKind typeKind;
 
-        std::shared_ptr<TypeQualifierSet> qualifiers;
+        TypeQualifiers qualifiers;
 
         Type(
             std::string name,
             TypeKind kind,
-
-            std::shared_ptr<TypeQualifierSet> qualifiers =
-                std::make_shared<TypeQualifierSet>()
+            TypeQualifiers qualifiers = {}
         ) noexcept;
     };
 }
@@ -6,10 +6,7 @@ namespace ionlang {
     struct Pass;
 
     struct BooleanType : Type {
-        explicit BooleanType(
-            std::shared_ptr<TypeQualifierSet> qualifiers =
-                std::make_shared<TypeQualifierSet>()
-        );
+        explicit BooleanType(TypeQualifiers qualifiers = {});
 
         void accept(Pass& pass) override;
     };
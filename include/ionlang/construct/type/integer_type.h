@@ -25,9 +25,7 @@ namespace ionlang {
         explicit IntegerType(
             IntegerKind kind,
             bool isSigned = true,
-
-            std::shared_ptr<TypeQualifierSet> qualifiers =
-                std::make_shared<TypeQualifierSet>()
+            TypeQualifiers qualifiers = {}
         );
 
         void accept(Pass& pass) override;
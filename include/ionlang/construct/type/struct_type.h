@@ -7,23 +7,25 @@
 namespace ionlang {
     struct Pass;
 
-    typedef ionshared::PtrSymbolTable<Resolvable<Type>> Fields;
+    typedef ScopeTable<Resolvable<Type>> Fields;
+
+    typedef ScopeTable<Method> Methods;
 
     struct StructType : ConstructWithParent<Module, Type, std::string, TypeKind> {
         static std::shared_ptr<StructType> make(
             const std::string& name,
-            const Fields& fields,
-            const ionshared::PtrSymbolTable<Method>& methods
+            Fields fields,
+            Methods methods
         ) noexcept;
 
         Fields fields;
 
-        ionshared::PtrSymbolTable<Method> methods;
+        Methods methods;
 
         StructType(
             std::string name,
             Fields fields,
-            ionshared::PtrSymbolTable<Method> methods
+            Methods methods
         );
 
         void accept(Pass& visitor) override;
@@ -99,4 +99,11 @@ namespace ionlang::diagnostic {
         "There is no intrinsic module named '%s'",
         std::nullopt
     );
+
+    IONLANG_NOTICE_DEFINE(
+        typeUserDefinedQualified,
+        ionshared::DiagnosticKind::Error,
+        "User-defined type '%s' cannot be qualified",
+        std::nullopt
+    );
 }
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace ionlang {
+    /**
+     * A fixed-size thread pool which runs batches of indexed tasks. Each
+     * worker owns a deque of tasks: it takes tasks from the back of its
+     * own deque, and once it runs dry, steals from the front of the
+     * others'. Since tasks of a batch are handed out to workers in
+     * contiguous ranges, a worker mostly processes neighbouring tasks,
+     * while stealing evens out tasks of uneven cost.
+     *
+     * The calling thread participates in each batch as the first worker,
+     * so a pool of a single worker spawns no threads at all.
+     */
+    class WorkStealingPool {
+    public:
+        /**
+         * Invoked with the task index, and the index of the worker
+         * running it. Must not throw.
+         */
+        typedef std::function<void(size_t taskIndex, size_t workerIndex)> TaskCallback;
+
+    private:
+        struct Worker {
+            std::mutex mutex;
+
+            std::deque<size_t> tasks;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+
+        std::condition_variable batchCondition;
+
+        std::condition_variable doneCondition;
+
+        const TaskCallback* callback;
+
+        // Incremented for every batch, so that idle threads notice new batches.
+        uint64_t batchGeneration;
+
+        // Threads which are currently processing the batch.
+        size_t activeThreadCount;
+
+        bool isStopping;
+
+        std::atomic<size_t> remainingTaskCount;
+
+        [[nodiscard]] std::optional<size_t> takeTask(size_t workerIndex);
+
+        void runTasks(size_t workerIndex);
+
+        void runThread(size_t workerIndex);
+
+    public:
+        /**
+         * Defaults to the amount of hardware threads available.
+         */
+        explicit WorkStealingPool(size_t workerCount = 0);
+
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool& other) = delete;
+
+        WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+
+        [[nodiscard]] size_t getWorkerCount() const noexcept;
+
+        /**
+         * Run the callback for every index in [0, taskCount), and block
+         * until all of them completed. Batches must not be run
+         * concurrently, nor from within a task.
+         */
+        void run(size_t taskCount, const TaskCallback& callback);
+    };
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <ionlang/passes/pass.h>
+
+/**
+ * The single list of visitable constructs, from which visitor dispatch
+ * is generated. Each entry names the visit method suffix, the construct
+ * type and the kind which identifies it. Constructs are grouped by the
+ * kind enumeration they are identified by: their construct kind, or the
+ * statement, expression or type kind of their category.
+ */
+#define IONLANG_CONSTRUCT_LIST(CONSTRUCT, STATEMENT, EXPRESSION, TYPE) \
+    CONSTRUCT(Module, Module, Module) \
+    CONSTRUCT(Prototype, Prototype, Prototype) \
+    CONSTRUCT(Extern, Extern, Extern) \
+    CONSTRUCT(Function, Function, Function) \
+    CONSTRUCT(Global, Global, Global) \
+    CONSTRUCT(Block, Block, Block) \
+    CONSTRUCT(Resolvable, Resolvable<>, Resolvable) \
+    CONSTRUCT(ErrorMarker, ErrorMarker, ErrorMarker) \
+    CONSTRUCT(Attribute, Attribute, Attribute) \
+    CONSTRUCT(ArgumentList, ArgumentList, ArgumentList) \
+    CONSTRUCT(Identifier, Identifier, Identifier) \
+    CONSTRUCT(Import, Import, Import) \
+    CONSTRUCT(Method, Method, Method) \
+    STATEMENT(IfStmt, IfStmt, If) \
+    STATEMENT(ReturnStmt, ReturnStmt, Return) \
+    STATEMENT(VariableDeclStmt, VariableDeclStmt, VariableDeclaration) \
+    STATEMENT(AssignmentStmt, AssignmentStmt, Assignment) \
+    STATEMENT(ExprWrapperStmt, ExprWrapperStmt, ExprWrapper) \
+    STATEMENT(BlockWrapperStatement, BlockWrapperStmt, BlockWrapper) \
+    EXPRESSION(CallExpr, CallExpr, Call) \
+    EXPRESSION(OperationExpr, OperationExpr, Operation) \
+    EXPRESSION(VariableRefExpr, VariableRefExpr, VariableReference) \
+    EXPRESSION(BooleanLiteral, BooleanLiteral, BooleanLiteral) \
+    EXPRESSION(CharLiteral, CharLiteral, CharLiteral) \
+    EXPRESSION(IntegerLiteral, IntegerLiteral, IntegerLiteral) \
+    EXPRESSION(StringLiteral, StringLiteral, StringLiteral) \
+    EXPRESSION(StructDefinition, StructDefExpr, StructDefinition) \
+    EXPRESSION(CastExpr, CastExpr, Cast) \
+    TYPE(VoidType, VoidType, Void) \
+    TYPE(BooleanType, BooleanType, Boolean) \
+    TYPE(IntegerType, IntegerType, Integer) \
+    TYPE(StructType, StructType, Struct)
+
+#define IONLANG_DISPATCH_IGNORE(name, type, kind)
+
+#define IONLANG_DISPATCH_CASE(name, type, kind) \
+    case kind: { \
+        visitor.visit##name(construct->staticCast<type>()); \
+        \
+        return; \
+    }
+
+#define IONLANG_DISPATCH_CONSTRUCT(name, type, kind) \
+    IONLANG_DISPATCH_CASE(name, type, ConstructKind::kind)
+
+#define IONLANG_DISPATCH_STATEMENT(name, type, kind) \
+    IONLANG_DISPATCH_CASE(name, type, StatementKind::kind)
+
+#define IONLANG_DISPATCH_EXPRESSION(name, type, kind) \
+    IONLANG_DISPATCH_CASE(name, type, ExpressionKind::kind)
+
+#define IONLANG_DISPATCH_TYPE(name, type, kind) \
+    IONLANG_DISPATCH_CASE(name, type, TypeKind::kind)
+
+namespace ionlang {
+    /**
+     * Invoke the visit method of the visitor which corresponds to the
+     * construct's kind, without visiting its children. The kind is
+     * switched upon directly instead of calling the construct's
+     * accept method, so that a visitor whose visit methods are not
+     * virtual has them inlined. Kinds with no corresponding construct
+     * type are ignored.
+     */
+    template<typename TVisitor>
+    inline void dispatchConstruct(TVisitor& visitor, const std::shared_ptr<Construct>& construct) {
+        switch (construct->constructKind) {
+            IONLANG_CONSTRUCT_LIST(
+                IONLANG_DISPATCH_CONSTRUCT,
+                IONLANG_DISPATCH_IGNORE,
+                IONLANG_DISPATCH_IGNORE,
+                IONLANG_DISPATCH_IGNORE
+            )
+
+            case ConstructKind::Statement: {
+                switch (construct->staticCast<Statement>()->statementKind) {
+                    IONLANG_CONSTRUCT_LIST(
+                        IONLANG_DISPATCH_IGNORE,
+                        IONLANG_DISPATCH_STATEMENT,
+                        IONLANG_DISPATCH_IGNORE,
+                        IONLANG_DISPATCH_IGNORE
+                    )
+
+                    default: {
+                        return;
+                    }
+                }
+            }
+
+            case ConstructKind::Expression: {
+                switch (construct->staticCast<Expression<>>()->expressionKind) {
+                    IONLANG_CONSTRUCT_LIST(
+                        IONLANG_DISPATCH_IGNORE,
+                        IONLANG_DISPATCH_IGNORE,
+                        IONLANG_DISPATCH_EXPRESSION,
+                        IONLANG_DISPATCH_IGNORE
+                    )
+
+                    default: {
+                        return;
+                    }
+                }
+            }
+
+            case ConstructKind::Type: {
+                switch (construct->staticCast<Type>()->typeKind) {
+                    IONLANG_CONSTRUCT_LIST(
+                        IONLANG_DISPATCH_IGNORE,
+                        IONLANG_DISPATCH_IGNORE,
+                        IONLANG_DISPATCH_IGNORE,
+                        IONLANG_DISPATCH_TYPE
+                    )
+
+                    default: {
+                        return;
+                    }
+                }
+            }
+
+            default: {
+                return;
+            }
+        }
+    }
+}
+
+#undef IONLANG_DISPATCH_IGNORE
+#undef IONLANG_DISPATCH_CASE
+#undef IONLANG_DISPATCH_CONSTRUCT
+#undef IONLANG_DISPATCH_STATEMENT
+#undef IONLANG_DISPATCH_EXPRESSION
+#undef IONLANG_DISPATCH_TYPE
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    /**
+     * Runs several passes in a single traversal. Upon each construct,
+     * the passes are entered in order, then the children are visited
+     * once for all of them, then the passes are left in order. A pass
+     * thus sees the work of the passes before it on the current
+     * construct and on every construct visited before it, but not on
+     * those visited after it.
+     *
+     * Only passes which do all of their work through the enter, leave
+     * and abort hooks may be fused: an overridden visit() or
+     * visitChildren() of a member pass is never invoked.
+     */
+    class FusedPass : public Pass {
+    private:
+        std::vector<std::shared_ptr<Pass>> passes;
+
+    public:
+        FusedPass(
+            std::shared_ptr<ionshared::PassContext> context,
+            std::vector<std::shared_ptr<Pass>> passes
+        ) noexcept;
+
+        /**
+         * If a pass throws upon entering, the passes entered before it
+         * are aborted, so that every entered pass is either left or
+         * aborted.
+         */
+        void enterConstruct(const std::shared_ptr<Construct>& construct) override;
+
+        /**
+         * Likewise, if a pass throws upon leaving, the passes after it
+         * are aborted.
+         */
+        void leaveConstruct(const std::shared_ptr<Construct>& construct) override;
+
+        void abortConstruct(const std::shared_ptr<Construct>& construct) override;
+
+        [[nodiscard]] const std::vector<std::shared_ptr<Pass>>& getPasses() const noexcept;
+    };
+}
@@ -1,11 +1,65 @@
 #pragma once
 
-#include <ionshared/container/lowering_symbol_table.h>
+#include <array>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 #include <ionir/construct/basic_block.h>
 #include <ionlang/misc/ionir_emitted_entities.h>
+#include <ionlang/misc/work_stealing_pool.h>
+#include <ionlang/passes/lowering/linear_body.h>
 #include <ionlang/passes/pass.h>
+#include <ionlang/tracking/concurrent_scope_table.h>
+#include <ionlang/tracking/construct_table.h>
 
 namespace ionlang {
+    /**
+     * Receives a function once its body was lowered, along with its
+     * IonIR counterpart.
+     */
+    typedef std::function<void(
+        const std::shared_ptr<Function>& function,
+        const std::shared_ptr<ionir::Function>& irFunction
+    )> LoweredFunctionSink;
+
+    /**
+     * Options controlling how modules are lowered to IonIR.
+     */
+    struct LoweringOptions {
+        /**
+         * Whether straight-line blocks should be linearized and lowered
+         * sequentially, instead of being visited through the construct
+         * tree.
+         */
+        bool useLinearBodies = false;
+
+        /**
+         * Whether locals which are never assigned to should be bound
+         * directly to their lowered value, instead of being given a stack
+         * slot which every reference goes through. Only locals whose value
+         * is a constant or an already emitted instruction are promoted.
+         */
+        bool promoteImmutableLocals = true;
+
+        /**
+         * If provided, the function bodies of a module are lowered in
+         * parallel on the pool, once its top-level constructs have all
+         * been declared.
+         */
+        ionshared::OptPtr<WorkStealingPool> workStealingPool = std::nullopt;
+
+        /**
+         * If provided, modules are lowered in streaming mode: each
+         * function is handed to the sink as soon as its body was lowered,
+         * after which both its body and the IonIR body are released, so
+         * that only declarations stay resident. Function bodies are then
+         * lowered serially, one at a time.
+         */
+        std::optional<LoweredFunctionSink> functionSink = std::nullopt;
+    };
+
     class IonIrLoweringPass : public Pass {
     private:
         struct IonIrBuffers {
@@ -15,38 +69,178 @@ namespace ionlang {
 
             ionshared::Stack<std::shared_ptr<ionir::BasicBlock>> basicBlocks{};
 
+            /**
+             * Top-level entities lowered onto each buffered module, by
+             * name. This is the authoritative record of which names are
+             * taken on a module, and may be shared between workers
+             * lowering the same module. The IonIR module's own scope is
+             * not safe for concurrent use.
+             */
+            ionshared::Stack<std::shared_ptr<ConcurrentScopeTable<ionir::Construct>>> globalScopes{};
+
+            /**
+             * The heights of the buffer stacks at some point of lowering.
+             * Visit methods push and pop their own buffers in balance, so
+             * restoring a checkpoint only ever pops what was left above
+             * it, and never needs a copy of the stacks.
+             */
+            struct Checkpoint {
+                size_t moduleCount;
+
+                size_t functionCount;
+
+                size_t basicBlockCount;
+
+                size_t globalScopeCount;
+            };
+
             std::shared_ptr<ionir::InstBuilder> makeBuilder();
+
+            [[nodiscard]] Checkpoint makeCheckpoint() const;
+
+            /**
+             * Pop every buffer pushed since the checkpoint was made. Throws
+             * if a buffer present at the checkpoint was popped since, as
+             * the stacks then cannot be restored without a copy.
+             */
+            void restore(const Checkpoint& checkpoint);
         };
 
-        [[nodiscard]] static std::shared_ptr<ionir::Type> processTypeQualifiers(
-            std::shared_ptr<ionir::Type> type,
-            const std::shared_ptr<TypeQualifierSet>& qualifiers
-        );
+        /**
+         * Lowered types of the module being lowered. Shared by the workers
+         * lowering function bodies in parallel, so that each distinct type
+         * is lowered once per module, as in serial lowering.
+         */
+        struct IonIrTypeCache {
+            // Guards both caches. Entries are only written upon creation.
+            std::mutex mutex{};
+
+            /**
+             * Lowered qualifier sets, indexed by qualifier flags. Types with
+             * identical qualifiers share the same IonIR qualifier set.
+             */
+            std::array<
+                std::shared_ptr<ionir::TypeQualifiers>,
+                TypeQualifiers::combinationCount
+            > qualifierSets{};
+
+            /**
+             * Lowered types other than structs, by structural key (type
+             * kind, integer kind and signedness, and qualifier flags).
+             * Every AST type with the same key shares a single IonIR type.
+             * Structs are excluded, since two definitions are distinct
+             * types even if their fields are the same.
+             */
+            std::unordered_map<uint32_t, std::shared_ptr<ionir::Type>> types{};
+        };
+
+        /**
+         * IonIR counterparts of type qualifiers, indexed by the bit
+         * position of the qualifier's flag. Qualifiers without an IonIR
+         * counterpart have no value.
+         */
+        static const std::array<
+            std::optional<ionir::TypeQualifier>,
+            TypeQualifiers::qualifierCount
+        > irTypeQualifierMap;
 
         ionshared::PtrSymbolTable<ionir::Module> modules;
 
         IonIrBuffers irBuffers;
 
-        ionshared::LoweringSymbolTable<
-            std::shared_ptr<Construct>,
-            std::shared_ptr<ionir::Construct>
-        > symbolTable;
+        /**
+         * Lowered counterparts of the constructs visited so far, indexed
+         * by construct ID.
+         */
+        ConstructTable<ionir::Construct> symbolTable;
 
         uint32_t nameCounter;
 
+        LoweringOptions options;
+
         /**
-         * Backup current buffers, invoke the callback and restore the
-         * stashed buffers.
+         * Locals assigned to within the function being lowered. Has no
+         * value outside of a function, or if immutable locals are not
+         * promoted, in which case every local is given a stack slot.
          */
-        void stashBuffers(const std::function<void()>& callback);
+        std::optional<std::unordered_set<const VariableDeclStmt*>> assignedVariableDecls;
+
+        std::shared_ptr<IonIrTypeCache> irTypeCache;
 
         [[nodiscard]] uint32_t getNameCounter() noexcept;
 
+        /**
+         * Lower the function's prototype and register the function, with
+         * an empty body, on the buffered module. Bodies are lowered
+         * separately, so that they may refer to any declared function
+         * regardless of declaration order.
+         */
+        void declareFunction(const std::shared_ptr<Function>& function);
+
+        /**
+         * Lower the body of a previously declared function into its
+         * IonIR counterpart.
+         */
+        void lowerFunctionBody(const std::shared_ptr<Function>& function);
+
+        /**
+         * Lower the body of a previously declared function, hand it to
+         * the function sink and release it, along with every lowering
+         * result created for it.
+         */
+        void streamFunctionBody(const std::shared_ptr<Function>& function);
+
+        /**
+         * Lower the bodies of the provided declared functions on the
+         * pool. Each worker lowers onto its own instance of this pass,
+         * which only shares the module and its top-level entities.
+         */
+        void lowerFunctionBodiesInParallel(
+            const std::vector<std::shared_ptr<Construct>>& topLevelConstructs,
+            const std::vector<std::shared_ptr<Function>>& functions
+        );
+
+        [[nodiscard]] bool requiresStackSlot(const VariableDeclStmt* variableDecl) const noexcept;
+
+        /**
+         * Emit the linearized statements of a block onto the buffered
+         * basic block. Nodes are visited in storage order, which is
+         * post-order, so operands are always lowered before their users.
+         */
+        void lowerLinearBody(const LinearBody& linearBody);
+
+        /**
+         * Must be invoked while holding the type cache's lock.
+         */
+        [[nodiscard]] std::shared_ptr<ionir::Type> lowerTypeQualifiers(
+            std::shared_ptr<ionir::Type> type,
+            TypeQualifiers qualifiers
+        );
+
+        /**
+         * Find the lowered type of the provided structural key, or create
+         * it if it was not lowered yet.
+         */
+        template<typename TCreate>
+        [[nodiscard]] std::shared_ptr<ionir::Type> findOrCreateIrType(
+            uint32_t typeKey,
+            TCreate create
+        ) {
+            std::lock_guard<std::mutex> lock{this->irTypeCache->mutex};
+            std::shared_ptr<ionir::Type>& irType = this->irTypeCache->types[typeKey];
+
+            if (irType == nullptr) {
+                irType = create();
+            }
+
+            return irType;
+        }
+
         /**
          * Visit and emit a construct if it has not been already
          * previously visited and emitted, and return the resulting
          * lowered construct by looking it up on the local symbol table.
-         * By default, buffers are stashed during visitation of the
+         * By default, buffers are checkpointed before visitation of the
          * construct and restored afterwards to avoid being overwritten.
          */
         template<typename T = ionir::Construct>
@@ -54,42 +248,38 @@ namespace ionlang {
         std::shared_ptr<T> safeEarlyVisitOrLookup(
             const std::shared_ptr<Construct>& construct,
             bool useDynamicCast = true,
-            bool stashBuffers = true
+            bool restoreBuffers = true
         ) {
-            /**
-             * NOTE: If specified, buffers must be stashed and restored after
-             * visitation, as the construct could be anything, including a block
-             * or a function, which, among others, alter buffers when being lowered.
-             */
-            if (stashBuffers) {
-                this->stashBuffers([&, this] {
-                    /**
-                     * NOTE: Construct is protected from being emitted more
-                     * than once during this call.
-                     */
-                    this->visit(construct);
-                });
-            }
-            else {
-                this->visit(construct);
-            }
+            // Constructs already lowered are only looked up.
+            if (!this->symbolTable.contains(*construct)) {
+                /**
+                 * NOTE: If specified, buffers must be restored after
+                 * visitation, as the construct could be anything, including
+                 * a block or a function, which, among others, alter buffers
+                 * when being lowered. Only the stack heights are recorded,
+                 * so this costs the same regardless of nesting depth.
+                 */
+                if (restoreBuffers) {
+                    IonIrBuffers::Checkpoint checkpoint = this->irBuffers.makeCheckpoint();
 
-            if (!this->symbolTable.contains(construct)) {
-                throw std::runtime_error("Visiting construct did not create an entry in the local symbol table");
+                    this->visit(construct);
+                    this->irBuffers.restore(checkpoint);
+                }
+                else {
+                    this->visit(construct);
+                }
             }
 
-            // TODO: Fix.
-//            return *this->symbolTable.find<T>(construct, useDynamicCast);
-            std::optional<std::shared_ptr<ionir::Construct>> lookupResult =
-                this->symbolTable.unwrap().lookup(construct);
+            const std::shared_ptr<ionir::Construct>& irConstruct =
+                this->symbolTable.find(*construct);
 
-            if (!ionshared::util::hasValue(lookupResult)) {
-                throw std::runtime_error("Value lookup failed");
+            if (irConstruct == nullptr) {
+                throw std::runtime_error("Visiting construct did not create an entry in the local symbol table");
             }
 
             return useDynamicCast
-                ? lookupResult->get()->dynamicCast<T>()
-                : lookupResult->get()->staticCast<T>();
+                ? irConstruct->dynamicCast<T>()
+                : irConstruct->staticCast<T>();
         }
 
     public:
@@ -97,7 +287,9 @@ namespace ionlang {
             std::shared_ptr<ionshared::PassContext> context,
 
             ionshared::PtrSymbolTable<ionir::Module> modules =
-                std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>()
+                std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>(),
+
+            LoweringOptions options = {}
         );
 
         [[nodiscard]] std::shared_ptr<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>> getModules() const;
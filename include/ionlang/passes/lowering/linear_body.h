@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <ionlang/construct/block.h>
+#include <ionlang/construct/expression.h>
+#include <ionlang/tracking/name_interner.h>
+
+namespace ionlang {
+    struct VariableDeclStmt;
+
+    enum struct LinearNodeKind : uint8_t {
+        IntegerLiteral,
+
+        BooleanLiteral,
+
+        CharLiteral,
+
+        StringLiteral,
+
+        VariableRef,
+
+        Operation,
+
+        Call,
+
+        VariableDecl,
+
+        Assignment,
+
+        Return,
+
+        ExprWrapper
+    };
+
+    enum struct LinearNodeFlag : uint8_t {
+        /**
+         * The node refers to a construct outside of the body (for
+         * example, a variable declared on an enclosing block). The
+         * operand is an index into the external constructs array
+         * instead of a node index.
+         */
+        External = 1 << 0,
+
+        /**
+         * The operation has a right side value, or the return
+         * statement has a value.
+         */
+        HasValue = 1 << 1
+    };
+
+    /**
+     * A compact node of a linear body. Operands are either indices of
+     * other nodes in the same body, or indices into one of the body's
+     * side arrays, depending on the node's kind:
+     *
+     * IntegerLiteral: first = integer, second = type.
+     * BooleanLiteral, CharLiteral: payload = value.
+     * StringLiteral: first = string.
+     * VariableRef: first = declaration node (or external construct).
+     * Operation: payload = operator, first = left node, second = right node.
+     * Call: payload = argument count, first = callee (external construct),
+     * second = offset of the argument nodes in the operand lists.
+     * VariableDecl: first = value node, second = name, third = type.
+     * Assignment: first = value node, second = declaration node
+     * (or external construct).
+     * Return: first = value node.
+     * ExprWrapper: first = expression node.
+     */
+    struct LinearNode {
+        LinearNodeKind kind;
+
+        uint8_t flags;
+
+        uint16_t payload;
+
+        uint32_t first;
+
+        uint32_t second;
+
+        uint32_t third;
+
+        [[nodiscard]] bool hasFlag(LinearNodeFlag flag) const noexcept;
+    };
+
+    /**
+     * A flattened encoding of a straight-line block, meant to be walked
+     * sequentially during lowering instead of chasing pointers through
+     * the construct tree. Nodes are stored in post-order, so the operands
+     * of a node always precede it. Only blocks without nested blocks (no
+     * if statements or block wrappers) and with fully resolved references
+     * can be linearized.
+     */
+    struct LinearBody {
+        /**
+         * Attempt to linearize the provided block. Returns no value if the
+         * block contains constructs which cannot be represented, in which
+         * case the block should be lowered through the construct tree.
+         */
+        [[nodiscard]] static std::optional<LinearBody> fromBlock(
+            const std::shared_ptr<Block>& block
+        );
+
+        std::vector<LinearNode> nodes;
+
+        std::vector<int64_t> integers;
+
+        std::vector<std::string> strings;
+
+        std::vector<InternedName> names;
+
+        std::vector<std::shared_ptr<Type>> types;
+
+        /**
+         * Constructs which live outside of the body, such as callees
+         * and variables declared on enclosing blocks.
+         */
+        std::vector<std::shared_ptr<Construct>> externals;
+
+        /**
+         * Node indices of call arguments, in order.
+         */
+        std::vector<uint32_t> operandLists;
+
+        /**
+         * The original variable declarations, in the order they appear.
+         * Required to register lowered declarations for lookups made
+         * from outside of the body.
+         */
+        std::vector<std::shared_ptr<VariableDeclStmt>> variableDecls;
+
+    private:
+        struct BuildState {
+            const Block* block;
+
+            // Node indices of the variable declarations linearized so far.
+            std::unordered_map<const VariableDeclStmt*, uint32_t> declIndices;
+        };
+
+        [[nodiscard]] std::optional<uint32_t> appendNode(LinearNode node);
+
+        [[nodiscard]] std::optional<uint32_t> appendStatement(
+            const std::shared_ptr<Statement>& statement,
+            BuildState& state
+        );
+
+        [[nodiscard]] std::optional<uint32_t> appendExpression(
+            const std::shared_ptr<Expression<>>& expression,
+            const BuildState& state
+        );
+
+        /**
+         * Resolve the operand referring to the provided variable
+         * declaration, setting the external flag on the node if the
+         * declaration lives outside of the body. Returns no value if
+         * the declaration belongs to the body but was not linearized
+         * yet.
+         */
+        [[nodiscard]] std::optional<uint32_t> appendVariableOperand(
+            LinearNode& node,
+            const std::shared_ptr<VariableDeclStmt>& variableDecl,
+            const BuildState& state
+        );
+    };
+}
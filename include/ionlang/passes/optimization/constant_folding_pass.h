@@ -0,0 +1,80 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <ionlang/passes/pass.h>
+#include <ionlang/type_system/compile_time_interpreter.h>
+#include <ionlang/type_system/constant_evaluation.h>
+
+namespace ionlang {
+    struct ConstantFoldingStatistics {
+        size_t foldedOperationCount = 0;
+
+        size_t propagatedReferenceCount = 0;
+
+        size_t evaluatedCallCount = 0;
+
+        /**
+         * IonIR values which lowering no longer builds: each folded
+         * operation and its operands become a single literal.
+         */
+        size_t removedIonIrNodeCount = 0;
+
+        void writeReport(std::ostream& stream) const;
+    };
+
+    /**
+     * Folds operations upon boolean and integer constants into literals,
+     * and propagates the values of variables initialized with a constant
+     * and never assigned to into their references. Expressions are folded
+     * once their statement was walked, so the pass may share a traversal
+     * with (and must run after) name resolution, and a declaration is
+     * folded before the statements which follow it refer to it. Given an
+     * interpreter, calls to functions upon constant arguments are
+     * evaluated and replaced by their result as well. Since evaluating a
+     * call walks the callee's body, the pass may then only visit whole
+     * modules (as a module pass), and throws if it enters a function
+     * outside of a module.
+     */
+    class ConstantFoldingPass : public Pass {
+    private:
+        ConstantFoldingStatistics statistics;
+
+        /**
+         * Names of the variables assigned to within the current function.
+         * Names are compared instead of declarations, since references
+         * further down the function may not be resolved yet. Shadowing
+         * can only make this more conservative.
+         */
+        std::unordered_set<std::string> assignedNames;
+
+        ionshared::OptPtr<CompileTimeInterpreter> interpreter;
+
+        // Whether a module is being visited, as opposed to a lone function.
+        bool isVisitingModule;
+
+        std::shared_ptr<Expression<>> foldExpression(
+            const std::shared_ptr<Expression<>>& expression,
+            const std::shared_ptr<Construct>& parent
+        );
+
+        void foldStatement(const std::shared_ptr<Statement>& statement);
+
+    public:
+        IONSHARED_PASS_ID;
+
+        explicit ConstantFoldingPass(
+            std::shared_ptr<ionshared::PassContext> context,
+            ionshared::OptPtr<CompileTimeInterpreter> interpreter = std::nullopt
+        ) noexcept;
+
+        void enterConstruct(const std::shared_ptr<Construct>& construct) override;
+
+        void leaveConstruct(const std::shared_ptr<Construct>& construct) override;
+
+        void abortConstruct(const std::shared_ptr<Construct>& construct) override;
+
+        [[nodiscard]] const ConstantFoldingStatistics& getStatistics() const noexcept;
+    };
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    struct DeadCodeEliminationStatistics {
+        /**
+         * Statements removed from their block, either because they followed
+         * a terminal statement or because they were an if statement whose
+         * taken branch was empty.
+         */
+        size_t removedStatementCount = 0;
+
+        /**
+         * If statements whose condition was a constant, and which were
+         * replaced by the statements of their taken branch, if any.
+         */
+        size_t removedBranchCount = 0;
+
+        size_t removedFunctionCount = 0;
+
+        size_t removedGlobalCount = 0;
+
+        void writeReport(std::ostream& stream) const;
+    };
+
+    /**
+     * Removes code which can never run or is never referred to, before it
+     * is lowered: statements following a terminal statement within the
+     * same block, branches of if statements whose condition is a boolean
+     * literal, and functions and globals which are unreachable from the
+     * exported names, if any were provided. Blocks are handled once their statements were
+     * walked, so the pass may share a traversal with (and must run after)
+     * name resolution and constant folding, to see the conditions the
+     * latter folded.
+     */
+    class DeadCodeEliminationPass : public Pass {
+    private:
+        DeadCodeEliminationStatistics statistics;
+
+        /**
+         * Names of the top-level constructs which are referred to from
+         * outside of the module, and from which reachability is computed.
+         * There is no export attribute yet, so these are provided by the
+         * driver. Functions have external linkage, so other objects may
+         * link against any of them: if none is provided, no top-level
+         * construct is removed.
+         */
+        std::unordered_set<std::string> exportedNames;
+
+        void eliminateBranches(const std::shared_ptr<Block>& block);
+
+        void eliminateUnreachableStatements(const std::shared_ptr<Block>& block);
+
+        void eliminateUnreachableTopLevelConstructs(const std::shared_ptr<Module>& module);
+
+    public:
+        IONSHARED_PASS_ID;
+
+        explicit DeadCodeEliminationPass(
+            std::shared_ptr<ionshared::PassContext> context,
+            std::unordered_set<std::string> exportedNames = {}
+        ) noexcept;
+
+        void leaveConstruct(const std::shared_ptr<Construct>& construct) override;
+
+        [[nodiscard]] const DeadCodeEliminationStatistics& getStatistics() const noexcept;
+    };
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ionlang/misc/work_stealing_pool.h>
+#include <ionlang/passes/pass.h>
+#include <ionlang/tracking/name_interner.h>
+
+namespace ionlang {
+    enum struct PassKind {
+        /**
+         * Visits the module as a whole, on the calling thread.
+         */
+        Module,
+
+        /**
+         * Visits a single function at a time, and may only touch that
+         * function, along with reading the module's global scope.
+         * Functions are processed in parallel, by an instance of the pass
+         * owned by each worker thread.
+         */
+        Function
+    };
+
+    /**
+     * Creates a pass instance. Function passes are instantiated once
+     * per worker thread, and may be instantiated on a worker thread.
+     */
+    typedef std::function<std::shared_ptr<Pass>(std::shared_ptr<ionshared::PassContext> context)> PassFactory;
+
+    /**
+     * How a pass may be ordered and fused with other passes.
+     */
+    struct PassSchedule {
+        /**
+         * Whether the pass does all of its work through the enter, leave
+         * and abort hooks, leaving the traversal to Pass::visit(). Such
+         * passes may share a single traversal with other fusible passes
+         * of the same kind.
+         */
+        bool isFusible = false;
+
+        /**
+         * Names of the passes which must run before this one. This pass
+         * only needs to see their work on each construct it visits, so
+         * it may share their traversal.
+         */
+        std::vector<std::string> dependencies{};
+
+        /**
+         * Names of the passes which must have visited the whole tree
+         * before this one starts, such that it may not share their
+         * traversal.
+         */
+        std::vector<std::string> completedDependencies{};
+    };
+
+    struct PassRegistration {
+        PassKind kind;
+
+        PassFactory factory;
+
+        /**
+         * Identifies the pass in compile time reports and traces. Interned,
+         * so that recorded trace spans may outlive the pass manager.
+         */
+        InternedName name;
+
+        PassSchedule schedule;
+
+        /**
+         * Names of the passes fused into this traversal, in traversal
+         * order. Empty if the registration is not a fused traversal.
+         */
+        std::vector<InternedName> fusedNames{};
+    };
+
+    /**
+     * Runs module and function passes, in the order they were registered,
+     * unless a pass depends on a pass registered after it. Consecutive
+     * fusible passes of the same kind are fused into a single traversal,
+     * up to the first pass which depends on the completion of one of
+     * them. Consecutive function passes form a single stage, up to the
+     * first pass which depends on the completion of a pass of the stage:
+     * each function goes through all passes of the stage within the same
+     * task, one function per task, on a work-stealing thread pool. Stages
+     * and module passes are separated by a barrier.
+     *
+     * Passes report errors by throwing. Errors are made deterministic
+     * by always re-throwing the error of the first function (in
+     * declaration order) which failed during a stage, regardless of
+     * which function failed first in time.
+     *
+     * When compile time profiling is enabled, each pass is timed as a
+     * phase. The time of function passes is summed across workers.
+     * When tracing is enabled, each visit of a function by a pass is
+     * recorded as a span, on the worker's thread.
+     */
+    class ParallelPassManager {
+    private:
+        std::vector<PassRegistration> passes;
+
+        WorkStealingPool workStealingPool;
+
+        /**
+         * Order the passes by their dependencies, keeping the registration
+         * order among passes which do not depend on each other.
+         */
+        [[nodiscard]] std::vector<PassRegistration> orderPasses() const;
+
+        void runFunctionStage(
+            const std::vector<PassRegistration>& registrations,
+            const std::vector<std::shared_ptr<Function>>& functions,
+            const std::shared_ptr<ionshared::PassContext>& context
+        );
+
+    public:
+        /**
+         * Collect the functions of the module, in declaration order.
+         */
+        [[nodiscard]] static std::vector<std::shared_ptr<Function>> collectFunctions(
+            const std::shared_ptr<Module>& module
+        );
+
+        /**
+         * Defaults to the amount of hardware threads available.
+         */
+        explicit ParallelPassManager(size_t threadCount = 0);
+
+        [[nodiscard]] size_t getThreadCount() const noexcept;
+
+        void registerPass(
+            PassKind kind,
+            PassFactory factory,
+            std::string name,
+            PassSchedule schedule = {}
+        );
+
+        void registerModulePass(
+            PassFactory factory,
+            std::string name = "module pass",
+            PassSchedule schedule = {}
+        );
+
+        void registerFunctionPass(
+            PassFactory factory,
+            std::string name = "function pass",
+            PassSchedule schedule = {}
+        );
+
+        /**
+         * Group the ordered passes into traversals, each fused group
+         * being registered as a single pass which runs a fused pass.
+         */
+        [[nodiscard]] std::vector<PassRegistration> planTraversals() const;
+
+        void run(
+            const std::shared_ptr<Module>& module,
+            const std::shared_ptr<ionshared::PassContext>& context
+        );
+    };
+}
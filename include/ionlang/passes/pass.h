@@ -43,10 +43,33 @@ namespace ionlang {
     struct Pass : ionshared::BasePass<Construct> {
         explicit Pass(std::shared_ptr<ionshared::PassContext> context);
 
+        /**
+         * Enter the construct, visit its children, then leave it. Passes
+         * which only do their work through the enter, leave and abort
+         * hooks may share a single traversal with other passes.
+         */
         void visit(std::shared_ptr<Construct> construct) override;
 
         virtual void visitChildren(std::shared_ptr<Construct> construct);
 
+        /**
+         * Invoked before the construct's children are visited. Dispatches
+         * to the construct's visit method by default.
+         */
+        virtual void enterConstruct(const std::shared_ptr<Construct>& construct);
+
+        /**
+         * Invoked once the construct's children were visited.
+         */
+        virtual void leaveConstruct(const std::shared_ptr<Construct>& construct);
+
+        /**
+         * Invoked instead of leaveConstruct() if visiting the construct's
+         * children threw, so that state kept since entering the construct
+         * may be unwound.
+         */
+        virtual void abortConstruct(const std::shared_ptr<Construct>& construct);
+
         virtual void visitModule(std::shared_ptr<Module> construct);
 
         virtual void visitPrototype(std::shared_ptr<Prototype> construct);
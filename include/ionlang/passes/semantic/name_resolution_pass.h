@@ -1,18 +1,27 @@
 #pragma once
 
 #include <ionshared/diagnostics/diagnostic.h>
-#include <ionshared/tracking/symbol_table.h>
 #include <ionlang/misc/helpers.h>
 #include <ionlang/passes/pass.h>
+#include <ionlang/tracking/scope_stack.h>
 
 namespace ionlang {
     /**
      * Resolves partial constructs which reference
      * undefined symbols at the time by their identifier(s).
+     *
+     * Variables are resolved during a single top-down walk, which keeps
+     * a stack of the enclosing block scopes. Each variable declaration
+     * is bound to its (depth, slot) on the stack once walked, and
+     * references resolve against the stack with a single lookup. As a
+     * consequence, a variable is only visible after its declaration,
+     * and its own initializer refers to any outer variable of the same
+     * name. Functions, externs and structs resolve against the global
+     * scope of the module.
      */
     class NameResolutionPass : public Pass {
     private:
-        std::list<ionshared::PtrSymbolTable<Construct>> scope;
+        ScopeStack<VariableDeclStmt> scopeStack;
 
         [[nodiscard]] static ionshared::OptPtr<Construct> findGlobalConstruct(
             std::string name,
@@ -26,12 +35,14 @@ namespace ionlang {
             std::shared_ptr<ionshared::PassContext> context
         ) noexcept;
 
-        void visitModule(std::shared_ptr<Module> node) override;
+        void enterConstruct(const std::shared_ptr<Construct>& construct) override;
 
-        void visitScopeAnchor(std::shared_ptr<Scoped> node) override;
+        void leaveConstruct(const std::shared_ptr<Construct>& construct) override;
+
+        void abortConstruct(const std::shared_ptr<Construct>& construct) override;
 
         void visitResolvable(PtrResolvable<> node) override;
 
-        [[nodiscard]] const std::list<ionshared::PtrSymbolTable<Construct>>& getScope() const;
+        [[nodiscard]] const ScopeStack<VariableDeclStmt>& getScopeStack() const noexcept;
     };
 }
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <ionlang/passes/construct_dispatch.h>
+
+#define IONLANG_STATIC_PASS_VISIT(name, type, kind) \
+    void visit##name(const std::shared_ptr<type>& construct) { \
+    }
+
+namespace ionlang {
+    /**
+     * A pass whose visit methods are resolved at compile time. Derived
+     * passes inherit from this base, providing themselves as the template
+     * argument, and hide the visit methods they are interested in, using
+     * the same names as the virtual methods of Pass. Dispatch is a switch
+     * on the construct's kind which calls the derived pass' methods
+     * directly, so there is neither a virtual accept nor a virtual visit
+     * call per construct, and visit methods may be inlined.
+     *
+     * Hooks the derived pass may hide, besides the visit methods:
+     * visit(), which dispatches then visits the children, and
+     * visitChildren().
+     */
+    template<typename TDerived>
+    struct StaticPass {
+        void visit(const std::shared_ptr<Construct>& construct) {
+            dispatchConstruct(this->derived(), construct);
+            this->derived().visitChildren(construct);
+        }
+
+        void visitChildren(const std::shared_ptr<Construct>& construct) {
+            for (const auto& child : construct->getChildNodes()) {
+                this->derived().visit(child);
+            }
+        }
+
+        IONLANG_CONSTRUCT_LIST(
+            IONLANG_STATIC_PASS_VISIT,
+            IONLANG_STATIC_PASS_VISIT,
+            IONLANG_STATIC_PASS_VISIT,
+            IONLANG_STATIC_PASS_VISIT
+        )
+
+    private:
+        [[nodiscard]] TDerived& derived() noexcept {
+            return static_cast<TDerived&>(*this);
+        }
+    };
+}
+
+#undef IONLANG_STATIC_PASS_VISIT
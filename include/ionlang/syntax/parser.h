@@ -99,22 +99,19 @@ namespace ionlang {
         AstPtrResult<BooleanType> parseBooleanType(
             const std::shared_ptr<Construct>& parent,
 
-            const std::shared_ptr<TypeQualifierSet>& qualifiers =
-                std::make_shared<TypeQualifierSet>()
+            TypeQualifiers qualifiers = {}
         );
 
         AstPtrResult<IntegerType> parseIntegerType(
             const std::shared_ptr<Construct>& parent,
 
-            const std::shared_ptr<TypeQualifierSet>& qualifiers =
-                std::make_shared<TypeQualifierSet>()
+            TypeQualifiers qualifiers = {}
         );
 
         AstPtrResult<Resolvable<StructType>> parseStructType(
             const std::shared_ptr<Construct>& parent,
 
-            const std::shared_ptr<TypeQualifierSet>& qualifiers =
-                std::make_shared<TypeQualifierSet>()
+            TypeQualifiers qualifiers = {}
         );
 
         AstPtrResult<ArgumentList> parseArgumentList(const std::shared_ptr<Construct>& parent);
@@ -135,27 +132,27 @@ namespace ionlang {
 
         AstPtrResult<Expression<>> parseLiteral(const std::shared_ptr<Construct>& parent);
 
-        AstPtrResult<Expression<>> parseExpression(const std::shared_ptr<Block>& parent);
+        AstPtrResult<Expression<>> parseExpression(const std::shared_ptr<Construct>& parent);
 
-        AstPtrResult<Expression<>> parsePrimaryExpr(const std::shared_ptr<Block>& parent);
+        AstPtrResult<Expression<>> parsePrimaryExpr(const std::shared_ptr<Construct>& parent);
 
-        AstPtrResult<Expression<>> parseParenthesesExpr(const std::shared_ptr<Block>& parent);
+        AstPtrResult<Expression<>> parseParenthesesExpr(const std::shared_ptr<Construct>& parent);
 
-        AstPtrResult<Expression<>> parseIdExpr(const std::shared_ptr<Block>& parent);
+        AstPtrResult<Expression<>> parseIdExpr(const std::shared_ptr<Construct>& parent);
 
         AstPtrResult<Expression<>> parseOperationExpr(
             uint32_t expressionPrecedence,
             std::shared_ptr<Expression<>> leftSideExpression,
-            const std::shared_ptr<Block>& parent
+            const std::shared_ptr<Construct>& parent
         );
 
-        AstPtrResult<CallExpr> parseCallExpr(const std::shared_ptr<Block>& parent);
+        AstPtrResult<CallExpr> parseCallExpr(const std::shared_ptr<Construct>& parent);
 
         AstPtrResult<StructDefExpr> parseStructDefExpr(
-            const std::shared_ptr<Block>& parent
+            const std::shared_ptr<Construct>& parent
         );
 
-        AstPtrResult<CastExpr> parseCastExpr(const std::shared_ptr<Block>& parent);
+        AstPtrResult<CastExpr> parseCastExpr(const std::shared_ptr<Construct>& parent);
 
         AstPtrResult<Block> parseBlock(const std::shared_ptr<Construct>& parent);
 
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <ionlang/construct/construct.h>
+
+namespace ionlang {
+    struct Context;
+
+    enum struct ReclaimMode {
+        /**
+         * Release nodes on the calling thread, iteratively.
+         */
+        Synchronous,
+
+        /**
+         * Hand nodes over to a background thread, which releases them
+         * iteratively.
+         */
+        Background
+    };
+
+    /**
+     * Releases construct graphs without recursing through their
+     * destructors. All reachable nodes are first collected into a flat
+     * list, then released parents-first, so that destroying any single
+     * node never cascades into its children (which are still being held).
+     * This keeps teardown of arbitrarily deep trees from overflowing the
+     * stack, and in background mode, moves its cost off the caller's
+     * thread entirely.
+     */
+    class AstReclaimer {
+    private:
+        struct Job {
+            Ast roots;
+
+            // Arbitrary owned object (for example, a lowering symbol table).
+            std::shared_ptr<void> object;
+        };
+
+        std::mutex mutex;
+
+        std::condition_variable jobCondition;
+
+        std::condition_variable drainCondition;
+
+        std::deque<Job> jobs;
+
+        std::thread thread;
+
+        ReclaimMode mode;
+
+        bool isStopping;
+
+        // Jobs which were enqueued, but not yet fully released.
+        size_t pendingJobCount;
+
+        void enqueue(Job job);
+
+        void run();
+
+    public:
+        /**
+         * The process-wide reclaimer, used by modules and passes. It
+         * defaults to synchronous mode. It is never destroyed, so that
+         * it may be safely used during static destruction; jobs still
+         * pending at process exit are simply abandoned.
+         */
+        [[nodiscard]] static AstReclaimer& getGlobal();
+
+        /**
+         * Release the provided roots on the calling thread. Nodes which
+         * are still owned elsewhere are left intact.
+         */
+        static void release(Ast roots);
+
+        explicit AstReclaimer(ReclaimMode mode = ReclaimMode::Synchronous);
+
+        /**
+         * Releases all pending jobs before returning.
+         */
+        ~AstReclaimer();
+
+        AstReclaimer(const AstReclaimer& other) = delete;
+
+        AstReclaimer& operator=(const AstReclaimer& other) = delete;
+
+        [[nodiscard]] ReclaimMode getMode();
+
+        /**
+         * Switching to synchronous mode waits for pending jobs to be
+         * released first.
+         */
+        void setMode(ReclaimMode mode);
+
+        /**
+         * Take ownership of the provided root, and release it (and its
+         * children) once no longer owned elsewhere.
+         */
+        void reclaim(std::shared_ptr<Construct> root);
+
+        void reclaim(Ast roots);
+
+        /**
+         * Take ownership of a module's context, releasing the top-level
+         * constructs of its global scope.
+         */
+        void reclaim(std::shared_ptr<Context> context);
+
+        /**
+         * Take ownership of an arbitrary object, such as a container
+         * holding constructs, and destroy it according to the current
+         * mode.
+         */
+        template<typename T>
+        void reclaimObject(T object) {
+            this->enqueue(Job{
+                {},
+                std::make_shared<T>(std::move(object))
+            });
+        }
+
+        /**
+         * Block until all jobs enqueued so far have been released.
+         */
+        void drain();
+
+        [[nodiscard]] size_t getPendingJobCount();
+    };
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ionlang/construct/function.h>
+#include <ionlang/tracking/hardware_counters.h>
+
+namespace ionlang {
+    /**
+     * What was measured during one or more invocations of a phase.
+     */
+    struct PhaseSample {
+        std::chrono::nanoseconds duration{0};
+
+        // Empty unless hardware counters are enabled and available.
+        HardwareCounts hardwareCounts{};
+
+        // Amount of work units (tokens, constructs, functions) processed.
+        size_t unitCount = 0;
+
+        PhaseSample& operator+=(const PhaseSample& other) noexcept;
+    };
+
+    /**
+     * Measures the clock and, if enabled, the hardware counters of the
+     * calling thread, from its construction until finished.
+     */
+    class PhaseSampler {
+    private:
+        std::chrono::steady_clock::time_point startTime;
+
+        std::optional<HardwareCounts> startHardwareCounts;
+
+    public:
+        PhaseSampler() noexcept;
+
+        [[nodiscard]] PhaseSample finish() const noexcept;
+    };
+
+    struct PhaseTiming {
+        std::string name;
+
+        // Amount of enclosing phases at the time the phase was first entered.
+        size_t depth;
+
+        size_t invocationCount;
+
+        // Name of the work units counted by the sample, if any.
+        std::string unit;
+
+        PhaseSample sample;
+    };
+
+    struct FunctionTiming {
+        std::string name;
+
+        std::optional<ionshared::SourceLocation> sourceLocation;
+
+        std::chrono::nanoseconds duration;
+    };
+
+    /**
+     * Collects wall-clock timings of compilation phases (lexing, parsing,
+     * each pass and lowering) and of lowering individual functions.
+     * Disabled by default: while disabled, timers only perform a single
+     * relaxed atomic load, and never read the clock.
+     *
+     * Phases of the same name are accumulated. Timings may be recorded
+     * from multiple threads at once; function passes run in parallel
+     * report their summed time, not their elapsed time.
+     *
+     * Phases may additionally sample hardware counters (cycles,
+     * instructions, branch misses and last level cache misses), which
+     * are reported as instructions per cycle and misses per work unit.
+     * Counters which are unavailable are left out of reports.
+     */
+    class CompileProfiler {
+    private:
+        static std::atomic<bool> enabled;
+
+        static std::atomic<bool> hardwareCountersEnabled;
+
+    public:
+        [[nodiscard]] static bool isEnabled() noexcept {
+            return CompileProfiler::enabled.load(std::memory_order_relaxed);
+        }
+
+        static void setEnabled(bool enabled) noexcept;
+
+        [[nodiscard]] static bool isHardwareCountersEnabled() noexcept {
+            return CompileProfiler::hardwareCountersEnabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Only takes effect while profiling is enabled. Each thread opens
+         * its counters upon its first sample.
+         */
+        static void setHardwareCountersEnabled(bool enabled) noexcept;
+
+        /**
+         * Discard all recorded timings.
+         */
+        static void reset();
+
+        /**
+         * Register the phase without recording an invocation, so that it
+         * is reported in the order it was entered rather than left.
+         */
+        static void declarePhase(std::string_view name, size_t depth);
+
+        static void recordPhase(
+            std::string_view name,
+            size_t depth,
+            const PhaseSample& sample,
+            std::string_view unit = {}
+        );
+
+        static void recordFunction(FunctionTiming timing);
+
+        /**
+         * Amount of phases currently entered by the calling thread.
+         */
+        [[nodiscard]] static size_t getPhaseDepth() noexcept;
+
+        /**
+         * Phases, in the order they were first entered.
+         */
+        [[nodiscard]] static std::vector<PhaseTiming> getPhases();
+
+        /**
+         * The slowest functions, slowest first.
+         */
+        [[nodiscard]] static std::vector<FunctionTiming> getSlowestFunctions(size_t count);
+
+        /**
+         * Write a human-readable summary of the phases, in the spirit of
+         * -ftime-report. Nested phases are indented below their parent,
+         * and percentages are relative to the sum of top-level phases.
+         */
+        static void writeReport(std::ostream& stream);
+
+        /**
+         * Write the phases and the provided amount of slowest functions
+         * (along with their source locations) as a single JSON object.
+         */
+        static void writeJson(std::ostream& stream, size_t slowestFunctionCount = 10);
+    };
+
+    /**
+     * Times the enclosing scope as a phase of the provided name, which
+     * must outlive the scope. Phases are nested within the phases
+     * entered by the same thread, unless a depth is provided (for
+     * phases run by worker threads on behalf of another thread).
+     */
+    class PhaseTimer {
+    private:
+        std::string_view name;
+
+        std::optional<size_t> depth;
+
+        // Whether the phase entered the calling thread's depth.
+        bool isNested;
+
+        std::optional<PhaseSampler> sampler;
+
+        std::string_view unit;
+
+        size_t unitCount;
+
+    public:
+        explicit PhaseTimer(
+            std::string_view name,
+            std::optional<size_t> depth = std::nullopt
+        ) noexcept;
+
+        ~PhaseTimer();
+
+        PhaseTimer(const PhaseTimer& other) = delete;
+
+        PhaseTimer& operator=(const PhaseTimer& other) = delete;
+
+        /**
+         * Report the amount of work units processed by the phase. The
+         * unit name must outlive the timer.
+         */
+        void setUnits(std::string_view unit, size_t unitCount) noexcept;
+    };
+
+    /**
+     * Times the enclosing scope as the processing of the provided
+     * function. Its name is only looked up if profiling is enabled.
+     */
+    class FunctionTimer {
+    private:
+        std::shared_ptr<Function> function;
+
+        std::optional<std::chrono::steady_clock::time_point> startTime;
+
+    public:
+        explicit FunctionTimer(const std::shared_ptr<Function>& function) noexcept;
+
+        ~FunctionTimer();
+
+        FunctionTimer(const FunctionTimer& other) = delete;
+
+        FunctionTimer& operator=(const FunctionTimer& other) = delete;
+    };
+}
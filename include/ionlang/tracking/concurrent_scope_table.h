@@ -0,0 +1,393 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+#include <ionshared/misc/helpers.h>
+#include <ionlang/tracking/memory_tracker.h>
+#include <ionlang/tracking/name_interner.h>
+
+namespace ionlang {
+    /**
+     * A symbol table which may be read and written from multiple threads
+     * at once, for scopes shared between workers (such as the global
+     * scope of a module). Lookups are lock-free. Inserts are spread over
+     * independently locked shards, each with its own open addressing
+     * (linear probing) index.
+     *
+     * Published entries are never mutated nor freed while the table is
+     * alive, since a concurrent reader may still be reading them. Instead,
+     * overwriting or removing an entry publishes a replacement. As a
+     * consequence, overwritten and removed values are kept alive until
+     * the table itself is destroyed.
+     */
+    template<typename T>
+    class ConcurrentScopeTable {
+    public:
+        struct Entry {
+            InternedName name;
+
+            std::shared_ptr<T> value;
+        };
+
+    private:
+        static constexpr size_t shardCount = 16;
+
+        static constexpr size_t initialSlotCount = 8;
+
+        struct Record {
+            InternedName name;
+
+            size_t hash;
+
+            // Removed entries are published with no value.
+            std::shared_ptr<T> value;
+
+            // Declaration order, across all shards.
+            uint64_t order;
+        };
+
+        struct Slots {
+            size_t mask;
+
+            std::unique_ptr<std::atomic<const Record*>[]> records;
+
+            explicit Slots(size_t slotCount) :
+                mask(slotCount - 1),
+                records(std::make_unique<std::atomic<const Record*>[]>(slotCount)) {
+                //
+            }
+
+            [[nodiscard]] size_t getSlotCount() const noexcept {
+                return this->mask + 1;
+            }
+        };
+
+        struct Shard {
+            // Serializes writers only. Readers never lock.
+            std::mutex mutex;
+
+            std::atomic<const Slots*> slots{nullptr};
+
+            // Occupied slots of the current index, including removed entries.
+            size_t occupiedSlotCount = 0;
+
+            // Everything ever published to this shard, freed along with the table.
+            std::vector<std::unique_ptr<const Record>> records;
+
+            std::vector<std::unique_ptr<const Slots>> slotGenerations;
+        };
+
+        std::unique_ptr<Shard[]> shards;
+
+        std::atomic<uint64_t> nextOrder;
+
+        std::atomic<size_t> size;
+
+        [[nodiscard]] static size_t hashName(std::string_view name) noexcept {
+            return std::hash<std::string_view>{}(name);
+        }
+
+        [[nodiscard]] static size_t findSlotIndex(
+            const Slots& slots,
+            size_t hash,
+            const InternedName& name
+        ) noexcept {
+            size_t slotIndex = (hash / ConcurrentScopeTable::shardCount) & slots.mask;
+            const Record* record;
+
+            while ((record = slots.records[slotIndex].load(std::memory_order_acquire)) != nullptr
+                && record->name != name) {
+                slotIndex = (slotIndex + 1) & slots.mask;
+            }
+
+            return slotIndex;
+        }
+
+        template<typename TMatcher>
+        [[nodiscard]] const Record* findRecord(size_t hash, TMatcher matcher) const noexcept {
+            const Shard& shard = this->shards[hash % ConcurrentScopeTable::shardCount];
+            const Slots* slots = shard.slots.load(std::memory_order_acquire);
+
+            if (slots == nullptr) {
+                return nullptr;
+            }
+
+            size_t slotIndex = (hash / ConcurrentScopeTable::shardCount) & slots->mask;
+
+            while (const Record* record = slots->records[slotIndex].load(std::memory_order_acquire)) {
+                if (record->hash == hash && matcher(*record)) {
+                    return record->value == nullptr ? nullptr : record;
+                }
+
+                slotIndex = (slotIndex + 1) & slots->mask;
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Replace the current index of the shard with one of the provided
+         * size, leaving out removed entries. Readers still probing the
+         * previous index observe the table as it was before the rebuild.
+         * Must be invoked while holding the shard's lock.
+         */
+        static void rebuildSlots(Shard& shard, size_t slotCount) {
+            const Slots* previousSlots = shard.slots.load(std::memory_order_relaxed);
+            auto slots = std::make_unique<Slots>(slotCount);
+
+            shard.occupiedSlotCount = 0;
+
+            if (previousSlots != nullptr) {
+                for (size_t i = 0; i < previousSlots->getSlotCount(); i++) {
+                    const Record* record =
+                        previousSlots->records[i].load(std::memory_order_relaxed);
+
+                    if (record == nullptr || record->value == nullptr) {
+                        continue;
+                    }
+
+                    slots->records[ConcurrentScopeTable::findSlotIndex(*slots, record->hash, record->name)]
+                        .store(record, std::memory_order_relaxed);
+
+                    shard.occupiedSlotCount++;
+                }
+            }
+
+            shard.slots.store(slots.get(), std::memory_order_release);
+            shard.slotGenerations.push_back(std::move(slots));
+        }
+
+    public:
+        ConcurrentScopeTable() :
+            shards(std::make_unique<Shard[]>(ConcurrentScopeTable::shardCount)),
+            nextOrder(0),
+            size(0) {
+            //
+        }
+
+        ConcurrentScopeTable(const ConcurrentScopeTable& other) = delete;
+
+        /**
+         * Not thread-safe. The moved-from table must not be used anymore.
+         */
+        ConcurrentScopeTable(ConcurrentScopeTable&& other) noexcept :
+            shards(std::move(other.shards)),
+            nextOrder(other.nextOrder.load(std::memory_order_relaxed)),
+            size(other.size.load(std::memory_order_relaxed)) {
+            // The entries now belong to this table, and are released by it only.
+            other.size.store(0, std::memory_order_relaxed);
+        }
+
+        ~ConcurrentScopeTable() {
+            if constexpr (MemoryTracker::isEnabled) {
+                for (size_t i = 0; i < this->getSize(); i++) {
+                    MemoryTracker::recordRelease(MemorySubject::SymbolTableEntry, 0, sizeof(Record));
+                }
+            }
+        }
+
+        ConcurrentScopeTable& operator=(const ConcurrentScopeTable& other) = delete;
+
+        ConcurrentScopeTable& operator=(ConcurrentScopeTable&& other) = delete;
+
+        /**
+         * Register a value under the provided name. Returns false and
+         * leaves the table untouched if the name is already registered
+         * and overwriting was not requested. Checking for an existing
+         * entry and inserting is atomic, so exactly one of several
+         * concurrent writers of the same name succeeds.
+         */
+        bool set(const InternedName& name, std::shared_ptr<T> value, bool overwrite = false) {
+            size_t hash = ConcurrentScopeTable::hashName(*name);
+            Shard& shard = this->shards[hash % ConcurrentScopeTable::shardCount];
+            std::lock_guard<std::mutex> lock{shard.mutex};
+
+            if (shard.slots.load(std::memory_order_relaxed) == nullptr) {
+                ConcurrentScopeTable::rebuildSlots(shard, ConcurrentScopeTable::initialSlotCount);
+            }
+
+            const Slots& slots = *shard.slots.load(std::memory_order_relaxed);
+            size_t slotIndex = ConcurrentScopeTable::findSlotIndex(slots, hash, name);
+
+            const Record* existingRecord =
+                slots.records[slotIndex].load(std::memory_order_relaxed);
+
+            bool isLive = existingRecord != nullptr && existingRecord->value != nullptr;
+
+            if (isLive && !overwrite) {
+                return false;
+            }
+
+            // Overwritten entries keep their place in declaration order.
+            uint64_t order = isLive
+                ? existingRecord->order
+                : this->nextOrder.fetch_add(1, std::memory_order_relaxed);
+
+            shard.records.push_back(std::make_unique<const Record>(Record{
+                name,
+                hash,
+                std::move(value),
+                order
+            }));
+
+            slots.records[slotIndex].store(shard.records.back().get(), std::memory_order_release);
+
+            if (!isLive) {
+                this->size.fetch_add(1, std::memory_order_relaxed);
+                MemoryTracker::recordAllocation(MemorySubject::SymbolTableEntry, 0, sizeof(Record));
+            }
+
+            if (existingRecord == nullptr) {
+                shard.occupiedSlotCount++;
+
+                // Keep the load factor at or below one half.
+                if (shard.occupiedSlotCount * 2 > slots.getSlotCount()) {
+                    ConcurrentScopeTable::rebuildSlots(shard, slots.getSlotCount() * 2);
+                }
+            }
+
+            return true;
+        }
+
+        bool set(std::string_view name, std::shared_ptr<T> value, bool overwrite = false) {
+            return this->set(
+                NameInterner::getGlobal().intern(name),
+                std::move(value),
+                overwrite
+            );
+        }
+
+        [[nodiscard]] ionshared::OptPtr<T> lookup(const InternedName& name) const noexcept {
+            const Record* record = this->findRecord(
+                ConcurrentScopeTable::hashName(*name),
+                [&name](const Record& record) { return record.name == name; }
+            );
+
+            if (record == nullptr) {
+                return std::nullopt;
+            }
+
+            return record->value;
+        }
+
+        /**
+         * Unlike the scope table, this does not go through the name
+         * interner, so that it remains lock-free.
+         */
+        [[nodiscard]] ionshared::OptPtr<T> lookup(std::string_view name) const noexcept {
+            const Record* record = this->findRecord(
+                ConcurrentScopeTable::hashName(name),
+                [name](const Record& record) { return *record.name == name; }
+            );
+
+            if (record == nullptr) {
+                return std::nullopt;
+            }
+
+            return record->value;
+        }
+
+        [[nodiscard]] bool contains(const InternedName& name) const noexcept {
+            return ionshared::util::hasValue(this->lookup(name));
+        }
+
+        [[nodiscard]] bool contains(std::string_view name) const noexcept {
+            return ionshared::util::hasValue(this->lookup(name));
+        }
+
+        bool remove(std::string_view name) {
+            std::optional<InternedName> internedName = NameInterner::getGlobal().find(name);
+
+            // A name which was never interned cannot be present.
+            if (!internedName.has_value()) {
+                return false;
+            }
+
+            size_t hash = ConcurrentScopeTable::hashName(name);
+            Shard& shard = this->shards[hash % ConcurrentScopeTable::shardCount];
+            std::lock_guard<std::mutex> lock{shard.mutex};
+            const Slots* slots = shard.slots.load(std::memory_order_relaxed);
+
+            if (slots == nullptr) {
+                return false;
+            }
+
+            size_t slotIndex = ConcurrentScopeTable::findSlotIndex(*slots, hash, *internedName);
+
+            const Record* existingRecord =
+                slots->records[slotIndex].load(std::memory_order_relaxed);
+
+            if (existingRecord == nullptr || existingRecord->value == nullptr) {
+                return false;
+            }
+
+            // The slot must remain occupied, so that probing continues past it.
+            shard.records.push_back(std::make_unique<const Record>(Record{
+                *internedName,
+                hash,
+                nullptr,
+                existingRecord->order
+            }));
+
+            slots->records[slotIndex].store(shard.records.back().get(), std::memory_order_release);
+            this->size.fetch_sub(1, std::memory_order_relaxed);
+            MemoryTracker::recordRelease(MemorySubject::SymbolTableEntry, 0, sizeof(Record));
+
+            return true;
+        }
+
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return this->getSize() == 0;
+        }
+
+        [[nodiscard]] size_t getSize() const noexcept {
+            return this->size.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Take a snapshot of the entries, in declaration order. Entries
+         * inserted while the snapshot is being taken may or may not be
+         * included.
+         */
+        [[nodiscard]] std::vector<Entry> getEntries() const {
+            std::vector<const Record*> records{};
+
+            records.reserve(this->getSize());
+
+            for (size_t i = 0; i < ConcurrentScopeTable::shardCount; i++) {
+                const Slots* slots = this->shards[i].slots.load(std::memory_order_acquire);
+
+                if (slots == nullptr) {
+                    continue;
+                }
+
+                for (size_t j = 0; j < slots->getSlotCount(); j++) {
+                    const Record* record = slots->records[j].load(std::memory_order_acquire);
+
+                    if (record != nullptr && record->value != nullptr) {
+                        records.push_back(record);
+                    }
+                }
+            }
+
+            std::sort(records.begin(), records.end(), [](const Record* first, const Record* second) {
+                return first->order < second->order;
+            });
+
+            std::vector<Entry> entries{};
+
+            entries.reserve(records.size());
+
+            for (const auto& record : records) {
+                entries.push_back(Entry{record->name, record->value});
+            }
+
+            return entries;
+        }
+    };
+}
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <memory>
+#include <new>
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <ionshared/misc/helpers.h>
+#include <ionlang/construct/construct.h>
+
+namespace ionlang {
+    /**
+     * Associates constructs with values, such as their lowered
+     * counterparts or other per-pass annotations. Values are stored in a
+     * flat array indexed by construct ID, relative to the ID of the first
+     * construct given a value, so lookups are a bounds check and an
+     * index, and the table holds no reference to the constructs
+     * themselves. Since IDs are sequential, the array spans roughly the
+     * constructs of the trees it annotates. Constructs whose IDs lie
+     * before the array or far past its end (created long before or after
+     * the rest) are kept in a hash map instead, so that the array never
+     * has to span the IDs of unrelated constructs created in between.
+     * Rolling back a journal moves the remaining values into the hash map
+     * and releases the array, which is then rebased onto the constructs
+     * given a value next.
+     */
+    template<typename T>
+    class ConstructTable {
+    private:
+        /**
+         * The least amount by which the array may grow at once to fit
+         * an ID past its end. It may otherwise grow by up to its own size.
+         */
+        static constexpr size_t minDenseGrowth = 64;
+
+        // Values indexed by construct ID minus the base ID. Null denotes no value.
+        std::vector<std::shared_ptr<T>> values;
+
+        ConstructId baseId;
+
+        /**
+         * Values of constructs whose IDs lie outside of the array, or
+         * whose values were kept when the array was released. A
+         * construct's value is never in both.
+         */
+        std::unordered_map<ConstructId, std::shared_ptr<T>> sparseValues;
+
+        size_t size;
+
+        /**
+         * IDs of the constructs which were given a value since the
+         * journal was started. Has no value if not journaling.
+         */
+        std::optional<std::vector<ConstructId>> journal;
+
+        [[nodiscard]] bool isDense(ConstructId constructId) const noexcept {
+            return constructId >= this->baseId
+                && constructId - this->baseId < this->values.size();
+        }
+
+        bool removeValue(ConstructId constructId) noexcept {
+            if (this->isDense(constructId) && this->values[constructId - this->baseId] != nullptr) {
+                this->values[constructId - this->baseId] = nullptr;
+            }
+            else if (this->sparseValues.erase(constructId) == 0) {
+                return false;
+            }
+
+            this->size--;
+
+            return true;
+        }
+
+        [[nodiscard]] const std::shared_ptr<T>* findValue(ConstructId constructId) const noexcept {
+            if (this->isDense(constructId) && this->values[constructId - this->baseId] != nullptr) {
+                return &this->values[constructId - this->baseId];
+            }
+
+            auto sparseValueIterator = this->sparseValues.find(constructId);
+
+            return sparseValueIterator != this->sparseValues.end()
+                ? &sparseValueIterator->second
+                : nullptr;
+        }
+
+        /**
+         * Move a construct's value kept in the hash map, if any, into its
+         * now empty slot in the array.
+         */
+        [[nodiscard]] std::shared_ptr<T>& takeSparseValue(
+            ConstructId constructId,
+            std::shared_ptr<T>& slot
+        ) noexcept {
+            if (slot == nullptr && !this->sparseValues.empty()) {
+                auto sparseValueIterator = this->sparseValues.find(constructId);
+
+                if (sparseValueIterator != this->sparseValues.end()) {
+                    slot = std::move(sparseValueIterator->second);
+                    this->sparseValues.erase(sparseValueIterator);
+                }
+            }
+
+            return slot;
+        }
+
+        /**
+         * Move the values of the array into the hash map, and release the
+         * array. The array is kept if the hash map cannot grow.
+         */
+        void releaseDenseValues() noexcept {
+            try {
+                for (size_t index = 0; index < this->values.size(); index++) {
+                    if (this->values[index] != nullptr) {
+                        this->sparseValues.emplace(this->baseId + index, this->values[index]);
+                    }
+                }
+            }
+            catch (const std::bad_alloc&) {
+                for (size_t index = 0; index < this->values.size(); index++) {
+                    if (this->values[index] != nullptr) {
+                        this->sparseValues.erase(this->baseId + index);
+                    }
+                }
+
+                return;
+            }
+
+            this->values = std::vector<std::shared_ptr<T>>{};
+        }
+
+        /**
+         * Find or make room for the value of a construct, either in the
+         * array, growing it if the ID is close enough past its end, or in
+         * the hash map otherwise.
+         */
+        [[nodiscard]] std::shared_ptr<T>& findOrInsertSlot(ConstructId constructId) {
+            if (this->values.empty()) {
+                this->baseId = constructId;
+            }
+
+            if (this->isDense(constructId)) {
+                return this->takeSparseValue(constructId, this->values[constructId - this->baseId]);
+            }
+
+            if (constructId >= this->baseId) {
+                ConstructId index = constructId - this->baseId;
+
+                ConstructId maxGrowth = std::max<ConstructId>(
+                    ConstructTable::minDenseGrowth,
+                    this->values.size()
+                );
+
+                if (index - this->values.size() < maxGrowth) {
+                    this->values.resize(index + 1);
+
+                    return this->takeSparseValue(constructId, this->values[index]);
+                }
+            }
+
+            return this->sparseValues[constructId];
+        }
+
+    public:
+        ConstructTable() noexcept :
+            values(),
+            baseId(0),
+            sparseValues(),
+            size(0),
+            journal(std::nullopt) {
+            //
+        }
+
+        [[nodiscard]] size_t getSize() const noexcept {
+            return this->size;
+        }
+
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return this->size == 0;
+        }
+
+        /**
+         * The amount of values the array has room for, not counting
+         * those kept in the hash map.
+         */
+        [[nodiscard]] size_t getDenseCapacity() const noexcept {
+            return this->values.capacity();
+        }
+
+        [[nodiscard]] bool contains(const Construct& construct) const noexcept {
+            const std::shared_ptr<T>* value = this->findValue(construct.constructId);
+
+            return value != nullptr && *value != nullptr;
+        }
+
+        /**
+         * Find the value of a construct without copying it. The result
+         * is null if the construct has no value, and is invalidated by
+         * any subsequent modification of the table.
+         */
+        [[nodiscard]] const std::shared_ptr<T>& find(const Construct& construct) const noexcept {
+            static const std::shared_ptr<T> none = nullptr;
+            const std::shared_ptr<T>* value = this->findValue(construct.constructId);
+
+            return value != nullptr ? *value : none;
+        }
+
+        [[nodiscard]] ionshared::OptPtr<T> lookup(const Construct& construct) const {
+            const std::shared_ptr<T>& value = this->find(construct);
+
+            if (value == nullptr) {
+                return std::nullopt;
+            }
+
+            return value;
+        }
+
+        /**
+         * Set the value of a construct, replacing any previous value.
+         * Setting a null value removes it.
+         */
+        void set(const Construct& construct, std::shared_ptr<T> value) {
+            ConstructId constructId = construct.constructId;
+
+            if (value == nullptr) {
+                this->remove(construct);
+
+                return;
+            }
+
+            std::shared_ptr<T>& slot = this->findOrInsertSlot(constructId);
+
+            if (slot == nullptr) {
+                this->size++;
+
+                if (this->journal.has_value()) {
+                    this->journal->push_back(constructId);
+                }
+            }
+
+            slot = std::move(value);
+        }
+
+        bool remove(const Construct& construct) noexcept {
+            return this->removeValue(construct.constructId);
+        }
+
+        void clear() noexcept {
+            this->values.clear();
+            this->baseId = 0;
+            this->sparseValues.clear();
+            this->size = 0;
+
+            if (this->journal.has_value()) {
+                this->journal->clear();
+            }
+        }
+
+        /**
+         * Start recording which constructs are given a value, so that
+         * they may be removed at once, including those which are no
+         * longer reachable from anywhere else. Restarts the journal if
+         * it was already started.
+         */
+        void startJournal() {
+            this->journal.emplace();
+        }
+
+        /**
+         * Remove the values of the constructs which were given one since
+         * the journal was started, and stop journaling. Values which were
+         * replaced rather than added are kept, and are moved out of the
+         * array, so that it does not keep spanning the removed values.
+         */
+        void rollbackJournal() noexcept {
+            if (!this->journal.has_value()) {
+                return;
+            }
+
+            for (ConstructId constructId : *this->journal) {
+                this->removeValue(constructId);
+            }
+
+            this->journal = std::nullopt;
+            this->releaseDenseValues();
+        }
+    };
+
+    /**
+     * Starts the journal of a table, and rolls it back once out of
+     * scope, including when an exception is thrown.
+     */
+    template<typename T>
+    class ConstructTableJournal {
+    private:
+        ConstructTable<T>& constructTable;
+
+    public:
+        explicit ConstructTableJournal(ConstructTable<T>& constructTable) :
+            constructTable(constructTable) {
+            this->constructTable.startJournal();
+        }
+
+        ConstructTableJournal(const ConstructTableJournal&) = delete;
+
+        ConstructTableJournal& operator=(const ConstructTableJournal&) = delete;
+
+        ~ConstructTableJournal() {
+            this->constructTable.rollbackJournal();
+        }
+    };
+}
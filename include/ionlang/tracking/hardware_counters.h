@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ionlang {
+    enum struct HardwareEvent : uint32_t {
+        Cycles,
+
+        Instructions,
+
+        BranchMisses,
+
+        // Last level cache read misses.
+        CacheMisses
+    };
+
+    /**
+     * Counts of hardware events. Events which could not be counted (for
+     * lack of support, permissions or counters) have no value.
+     */
+    struct HardwareCounts {
+        static constexpr size_t eventCount = 4;
+
+        std::array<std::optional<uint64_t>, HardwareCounts::eventCount> counts{};
+
+        [[nodiscard]] std::optional<uint64_t> get(HardwareEvent event) const noexcept;
+
+        [[nodiscard]] bool isEmpty() const noexcept;
+
+        [[nodiscard]] std::optional<double> findInstructionsPerCycle() const noexcept;
+
+        /**
+         * Events are only subtracted if present on both sides.
+         */
+        [[nodiscard]] HardwareCounts operator-(const HardwareCounts& other) const noexcept;
+
+        /**
+         * Events present on either side are accumulated.
+         */
+        HardwareCounts& operator+=(const HardwareCounts& other) noexcept;
+    };
+
+    /**
+     * Counts hardware events of a single thread, using perf events where
+     * available. Counting starts upon construction and never stops, so
+     * that phases are measured by the difference of two reads. Each
+     * event degrades individually: if an event cannot be opened, the
+     * others are still counted.
+     *
+     * Events are opened as a single group, so that they are scheduled
+     * together and read with a single system call. If the kernel
+     * multiplexes the group, counts are scaled by the fraction of time
+     * it was running.
+     */
+    class HardwareCounters {
+    private:
+        /**
+         * Events which were opened, in the order they were added to the
+         * group. The first opened event leads the group.
+         */
+        std::array<HardwareEvent, HardwareCounts::eventCount> openedEvents;
+
+        std::array<int, HardwareCounts::eventCount> fileDescriptors;
+
+        size_t openedEventCount;
+
+    public:
+        /**
+         * Counters of the calling thread, opened upon first use.
+         */
+        [[nodiscard]] static HardwareCounters& getForCurrentThread();
+
+        HardwareCounters();
+
+        ~HardwareCounters();
+
+        HardwareCounters(const HardwareCounters& other) = delete;
+
+        HardwareCounters& operator=(const HardwareCounters& other) = delete;
+
+        [[nodiscard]] bool isAvailable() const noexcept;
+
+        /**
+         * Counts since the counters were opened. Must be invoked on the
+         * thread which opened them.
+         */
+        [[nodiscard]] HardwareCounts read() const noexcept;
+    };
+}
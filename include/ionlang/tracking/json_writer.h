@@ -0,0 +1,13 @@
+#pragma once
+
+#include <ostream>
+#include <string_view>
+
+namespace ionlang::json {
+    /**
+     * Write a value as a quoted JSON string. Quotes, backslashes and
+     * control characters are escaped, so that the output stays valid
+     * whatever names or details it contains.
+     */
+    void writeString(std::ostream& stream, std::string_view value);
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+namespace ionlang {
+    /**
+     * What a memory counter accounts for. Kinds are interpreted relative
+     * to the subject: construct kinds for constructs, statement kinds for
+     * statements, and so on. Subjects without kinds use kind zero.
+     */
+    enum struct MemorySubject : uint32_t {
+        Construct,
+
+        Statement,
+
+        Expression,
+
+        Type,
+
+        Token,
+
+        SymbolTableEntry,
+
+        IonIrNode
+    };
+
+    struct MemoryCounter {
+        size_t liveCount = 0;
+
+        size_t liveBytes = 0;
+
+        size_t peakCount = 0;
+
+        size_t peakBytes = 0;
+
+        size_t totalCount = 0;
+
+        size_t totalBytes = 0;
+    };
+
+    /**
+     * Opt-in accounting of live objects and bytes, enabled by defining
+     * IONLANG_MEMORY_TRACKING (see the IONLANG_MEMORY_TRACKING CMake
+     * option). Otherwise, all recording functions are empty inline
+     * functions and queries return empty counters.
+     *
+     * Byte counts are shallow: they include the size of the object
+     * itself, but not what it owns on the heap. Tokens and IonIR nodes
+     * are handed over to their consumers, so only their creation is
+     * recorded (their live counters remain at zero).
+     */
+    class MemoryTracker {
+    public:
+        static constexpr size_t subjectCount = 7;
+
+        // Upper bound on the amount of kinds of any subject.
+        static constexpr size_t maxKindCount = 32;
+
+#ifdef IONLANG_MEMORY_TRACKING
+        static constexpr bool isEnabled = true;
+
+        static void recordAllocation(MemorySubject subject, uint32_t kind, size_t bytes) noexcept;
+
+        static void recordRelease(MemorySubject subject, uint32_t kind, size_t bytes) noexcept;
+
+        /**
+         * Record objects which are created, but whose release cannot be
+         * observed.
+         */
+        static void recordCreation(
+            MemorySubject subject,
+            uint32_t kind,
+            size_t count,
+            size_t bytes
+        ) noexcept;
+
+        /**
+         * Size of the construct class corresponding to the provided kind.
+         * Construct kinds which are refined by a statement, expression or
+         * type kind have no size of their own.
+         */
+        [[nodiscard]] static size_t findShallowSize(MemorySubject subject, uint32_t kind) noexcept;
+#else
+        static constexpr bool isEnabled = false;
+
+        static void recordAllocation(MemorySubject, uint32_t, size_t) noexcept {
+            //
+        }
+
+        static void recordRelease(MemorySubject, uint32_t, size_t) noexcept {
+            //
+        }
+
+        static void recordCreation(MemorySubject, uint32_t, size_t, size_t) noexcept {
+            //
+        }
+#endif
+
+        [[nodiscard]] static MemoryCounter getCounter(MemorySubject subject, uint32_t kind) noexcept;
+
+        /**
+         * Aggregated counter of all kinds of the provided subject. Its
+         * peak is the peak of the aggregate, not the sum of the peaks.
+         */
+        [[nodiscard]] static MemoryCounter getSubjectCounter(MemorySubject subject) noexcept;
+
+        /**
+         * Start a new phase: peaks are reset to the current live values,
+         * and totals to zero.
+         */
+        static void beginPhase() noexcept;
+
+        /**
+         * Write all subjects and kinds which recorded at least one object
+         * as a single JSON object, labeled with the provided phase name.
+         */
+        static void writeJson(std::ostream& stream, std::string_view phase);
+    };
+}
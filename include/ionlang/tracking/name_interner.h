@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ionlang {
+    class NameInterner;
+
+    /**
+     * A handle to a unique, immutable string owned by the name
+     * interner. Two interned names are equal if and only if their
+     * underlying strings are equal, which allows names to be compared
+     * and hashed in constant time.
+     */
+    class InternedName {
+        friend class NameInterner;
+
+    private:
+        const std::string* value;
+
+        explicit InternedName(const std::string* value) noexcept :
+            value(value) {
+            //
+        }
+
+    public:
+        [[nodiscard]] const std::string& operator*() const noexcept {
+            return *this->value;
+        }
+
+        const std::string* operator->() const noexcept {
+            return this->value;
+        }
+
+        [[nodiscard]] explicit operator std::string() const {
+            return *this->value;
+        }
+
+        [[nodiscard]] size_t getHash() const noexcept {
+            // Interned strings are never moved, so their address is their identity.
+            uint64_t hash = static_cast<uint64_t>(
+                reinterpret_cast<uintptr_t>(this->value) >> 4
+            ) * 0x9E3779B97F4A7C15ULL;
+
+            return static_cast<size_t>(hash ^ (hash >> 32));
+        }
+
+        bool operator==(const InternedName& other) const noexcept = default;
+    };
+
+    std::ostream& operator<<(std::ostream& stream, const InternedName& name);
+
+    /**
+     * Process-wide string pool for construct names. Interning is
+     * thread-safe, and interned strings live until the process exits.
+     */
+    class NameInterner {
+    private:
+        mutable std::shared_mutex mutex;
+
+        std::deque<std::string> strings;
+
+        std::unordered_map<std::string_view, const std::string*> index;
+
+    public:
+        [[nodiscard]] static NameInterner& getGlobal();
+
+        NameInterner() noexcept;
+
+        NameInterner(const NameInterner& other) = delete;
+
+        NameInterner& operator=(const NameInterner& other) = delete;
+
+        /**
+         * Return the interned handle for the provided name, creating
+         * it if it does not exist yet.
+         */
+        [[nodiscard]] InternedName intern(std::string_view name);
+
+        /**
+         * Return the interned handle for the provided name without
+         * creating one. Useful for lookups, where a name that was never
+         * interned cannot possibly be present on any table.
+         */
+        [[nodiscard]] std::optional<InternedName> find(std::string_view name) const;
+
+        [[nodiscard]] size_t getSize() const;
+    };
+}
+
+template<>
+struct std::hash<ionlang::InternedName> {
+    size_t operator()(const ionlang::InternedName& name) const noexcept {
+        return name.getHash();
+    }
+};
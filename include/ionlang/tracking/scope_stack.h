@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include <ionlang/tracking/name_interner.h>
+
+namespace ionlang {
+    /**
+     * The location of a declaration on a scope stack: the depth of its
+     * scope (zero being the outermost scope), and its slot within that
+     * scope, in declaration order.
+     */
+    struct ScopeBinding {
+        uint32_t depth;
+
+        uint32_t slot;
+
+        bool operator==(const ScopeBinding& other) const noexcept = default;
+    };
+
+    /**
+     * The lexical scopes enclosing the current position of a top-down
+     * walk. Declarations are bound as they are encountered, and remain
+     * visible until their scope is popped. Every name maps to the chain
+     * of its bindings, innermost last, so resolving a name is a single
+     * hash lookup regardless of how deeply scopes are nested, and a
+     * shadowed binding becomes visible again once the shadowing scope
+     * is popped.
+     */
+    template<typename T>
+    class ScopeStack {
+    private:
+        struct Scope {
+            std::vector<std::shared_ptr<T>> slots;
+
+            // Names declared in this scope, in declaration order.
+            std::vector<InternedName> names;
+        };
+
+        std::vector<Scope> scopes;
+
+        std::unordered_map<InternedName, std::vector<ScopeBinding>> bindings;
+
+    public:
+        /**
+         * Pops the scope it pushed upon destruction, including when
+         * unwinding.
+         */
+        class Guard {
+        private:
+            ScopeStack<T>& scopeStack;
+
+        public:
+            explicit Guard(ScopeStack<T>& scopeStack) :
+                scopeStack(scopeStack) {
+                this->scopeStack.push();
+            }
+
+            ~Guard() {
+                this->scopeStack.pop();
+            }
+
+            Guard(const Guard& other) = delete;
+
+            Guard& operator=(const Guard& other) = delete;
+        };
+
+        ScopeStack() :
+            scopes(),
+            bindings() {
+            //
+        }
+
+        [[nodiscard]] size_t getDepth() const noexcept {
+            return this->scopes.size();
+        }
+
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return this->scopes.empty();
+        }
+
+        void push() {
+            this->scopes.emplace_back();
+        }
+
+        void pop() {
+            if (this->scopes.empty()) {
+                throw std::runtime_error("Cannot pop scope: Scope stack is empty");
+            }
+
+            const std::vector<InternedName>& names = this->scopes.back().names;
+
+            // Unbind in reverse, so that repeated declarations unwind in order.
+            for (auto name = names.rbegin(); name != names.rend(); name++) {
+                this->bindings.find(*name)->second.pop_back();
+            }
+
+            this->scopes.pop_back();
+        }
+
+        /**
+         * Bind a declaration on the innermost scope, shadowing any
+         * visible declaration of the same name.
+         */
+        ScopeBinding declare(const InternedName& name, std::shared_ptr<T> value) {
+            if (this->scopes.empty()) {
+                throw std::runtime_error("Cannot declare: Scope stack is empty");
+            }
+
+            Scope& scope = this->scopes.back();
+
+            ScopeBinding binding{
+                static_cast<uint32_t>(this->scopes.size() - 1),
+                static_cast<uint32_t>(scope.slots.size())
+            };
+
+            scope.slots.push_back(std::move(value));
+            scope.names.push_back(name);
+            this->bindings[name].push_back(binding);
+
+            return binding;
+        }
+
+        /**
+         * Find the innermost visible binding of the provided name.
+         */
+        [[nodiscard]] std::optional<ScopeBinding> lookup(const InternedName& name) const {
+            auto chain = this->bindings.find(name);
+
+            if (chain == this->bindings.end() || chain->second.empty()) {
+                return std::nullopt;
+            }
+
+            return chain->second.back();
+        }
+
+        [[nodiscard]] const std::shared_ptr<T>& get(ScopeBinding binding) const {
+            return this->scopes[binding.depth].slots[binding.slot];
+        }
+    };
+}
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include <ionshared/misc/helpers.h>
+#include <ionlang/tracking/memory_tracker.h>
+#include <ionlang/tracking/name_interner.h>
+
+namespace ionlang {
+    /**
+     * A symbol table for a single lexical scope. Entries are keyed by
+     * interned name and stored in declaration order, with an open
+     * addressing (linear probing) index on the side for lookups. Storage
+     * is allocated on the first insertion, so the many scopes which never
+     * declare anything (most blocks, empty argument lists) cost a single
+     * null pointer.
+     */
+    template<typename T>
+    class ScopeTable {
+    public:
+        struct Entry {
+            InternedName name;
+
+            std::shared_ptr<T> value;
+        };
+
+        typedef typename std::vector<Entry>::const_iterator ConstIterator;
+
+    private:
+        // Slot value denoting an empty slot. Otherwise, it's the entry index plus one.
+        static constexpr uint32_t emptySlot = 0;
+
+        static constexpr size_t initialSlotCount = 8;
+
+        struct Storage {
+            std::vector<Entry> entries;
+
+            std::vector<uint32_t> slots;
+
+            Storage() = default;
+
+            Storage(const Storage& other) :
+                entries(other.entries),
+                slots(other.slots) {
+                if constexpr (MemoryTracker::isEnabled) {
+                    for (size_t i = 0; i < this->entries.size(); i++) {
+                        ScopeTable::recordEntryAllocation();
+                    }
+                }
+            }
+
+            ~Storage() {
+                if constexpr (MemoryTracker::isEnabled) {
+                    for (size_t i = 0; i < this->entries.size(); i++) {
+                        ScopeTable::recordEntryRelease();
+                    }
+                }
+            }
+        };
+
+        std::unique_ptr<Storage> storage;
+
+        static void recordEntryAllocation() noexcept {
+            MemoryTracker::recordAllocation(MemorySubject::SymbolTableEntry, 0, sizeof(Entry));
+        }
+
+        static void recordEntryRelease() noexcept {
+            MemoryTracker::recordRelease(MemorySubject::SymbolTableEntry, 0, sizeof(Entry));
+        }
+
+        [[nodiscard]] static size_t findSlotIndex(
+            const Storage& storage,
+            const InternedName& name
+        ) noexcept {
+            size_t mask = storage.slots.size() - 1;
+            size_t slotIndex = name.getHash() & mask;
+
+            while (storage.slots[slotIndex] != ScopeTable::emptySlot
+                && storage.entries[storage.slots[slotIndex] - 1].name != name) {
+                slotIndex = (slotIndex + 1) & mask;
+            }
+
+            return slotIndex;
+        }
+
+        static void rebuildSlots(Storage& storage, size_t slotCount) {
+            storage.slots.assign(slotCount, ScopeTable::emptySlot);
+
+            for (size_t i = 0; i < storage.entries.size(); i++) {
+                storage.slots[ScopeTable::findSlotIndex(storage, storage.entries[i].name)] =
+                    static_cast<uint32_t>(i + 1);
+            }
+        }
+
+        [[nodiscard]] std::optional<size_t> findEntryIndex(const InternedName& name) const noexcept {
+            if (this->storage == nullptr) {
+                return std::nullopt;
+            }
+
+            uint32_t slot =
+                this->storage->slots[ScopeTable::findSlotIndex(*this->storage, name)];
+
+            if (slot == ScopeTable::emptySlot) {
+                return std::nullopt;
+            }
+
+            return slot - 1;
+        }
+
+        [[nodiscard]] std::optional<size_t> findEntryIndex(std::string_view name) const {
+            // Avoid touching the interner at all for empty scopes.
+            if (this->storage == nullptr) {
+                return std::nullopt;
+            }
+
+            std::optional<InternedName> internedName =
+                NameInterner::getGlobal().find(name);
+
+            // A name which was never interned cannot be present.
+            if (!internedName.has_value()) {
+                return std::nullopt;
+            }
+
+            return this->findEntryIndex(*internedName);
+        }
+
+    public:
+        ScopeTable() noexcept :
+            storage(nullptr) {
+            //
+        }
+
+        ScopeTable(const ScopeTable& other) :
+            storage(other.storage == nullptr
+                ? nullptr
+                : std::make_unique<Storage>(*other.storage)) {
+            //
+        }
+
+        ScopeTable(ScopeTable&& other) noexcept = default;
+
+        ScopeTable& operator=(const ScopeTable& other) {
+            if (this != &other) {
+                this->storage = other.storage == nullptr
+                    ? nullptr
+                    : std::make_unique<Storage>(*other.storage);
+            }
+
+            return *this;
+        }
+
+        ScopeTable& operator=(ScopeTable&& other) noexcept = default;
+
+        /**
+         * Register a value under the provided name. Returns false and
+         * leaves the table untouched if the name is already registered
+         * and overwriting was not requested.
+         */
+        bool set(const InternedName& name, std::shared_ptr<T> value, bool overwrite = false) {
+            if (this->storage == nullptr) {
+                this->storage = std::make_unique<Storage>();
+                this->storage->slots.assign(ScopeTable::initialSlotCount, ScopeTable::emptySlot);
+            }
+
+            size_t slotIndex = ScopeTable::findSlotIndex(*this->storage, name);
+            uint32_t slot = this->storage->slots[slotIndex];
+
+            if (slot != ScopeTable::emptySlot) {
+                if (!overwrite) {
+                    return false;
+                }
+
+                this->storage->entries[slot - 1].value = std::move(value);
+
+                return true;
+            }
+
+            this->storage->entries.push_back(Entry{name, std::move(value)});
+            ScopeTable::recordEntryAllocation();
+            this->storage->slots[slotIndex] =
+                static_cast<uint32_t>(this->storage->entries.size());
+
+            // Keep the load factor at or below one half.
+            if (this->storage->entries.size() * 2 > this->storage->slots.size()) {
+                ScopeTable::rebuildSlots(*this->storage, this->storage->slots.size() * 2);
+            }
+
+            return true;
+        }
+
+        bool set(std::string_view name, std::shared_ptr<T> value, bool overwrite = false) {
+            return this->set(
+                NameInterner::getGlobal().intern(name),
+                std::move(value),
+                overwrite
+            );
+        }
+
+        [[nodiscard]] ionshared::OptPtr<T> lookup(const InternedName& name) const noexcept {
+            std::optional<size_t> entryIndex = this->findEntryIndex(name);
+
+            if (!entryIndex.has_value()) {
+                return std::nullopt;
+            }
+
+            return this->storage->entries[*entryIndex].value;
+        }
+
+        [[nodiscard]] ionshared::OptPtr<T> lookup(std::string_view name) const {
+            std::optional<size_t> entryIndex = this->findEntryIndex(name);
+
+            if (!entryIndex.has_value()) {
+                return std::nullopt;
+            }
+
+            return this->storage->entries[*entryIndex].value;
+        }
+
+        [[nodiscard]] bool contains(const InternedName& name) const noexcept {
+            return this->findEntryIndex(name).has_value();
+        }
+
+        [[nodiscard]] bool contains(std::string_view name) const {
+            return this->findEntryIndex(name).has_value();
+        }
+
+        /**
+         * Remove the entry registered under the provided name, if any.
+         * Declaration order of the remaining entries is preserved, at
+         * the cost of re-indexing the table.
+         */
+        bool remove(std::string_view name) {
+            std::optional<size_t> entryIndex = this->findEntryIndex(name);
+
+            if (!entryIndex.has_value()) {
+                return false;
+            }
+
+            this->storage->entries.erase(this->storage->entries.begin() + *entryIndex);
+            ScopeTable::recordEntryRelease();
+            ScopeTable::rebuildSlots(*this->storage, this->storage->slots.size());
+
+            return true;
+        }
+
+        void clear() noexcept {
+            this->storage.reset();
+        }
+
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return this->storage == nullptr || this->storage->entries.empty();
+        }
+
+        [[nodiscard]] size_t getSize() const noexcept {
+            return this->storage == nullptr ? 0 : this->storage->entries.size();
+        }
+
+        /**
+         * Whether storage was allocated for this table. Storage is only
+         * allocated once the first entry is registered.
+         */
+        [[nodiscard]] bool isAllocated() const noexcept {
+            return this->storage != nullptr;
+        }
+
+        /**
+         * Iterate entries in declaration order.
+         */
+        [[nodiscard]] ConstIterator begin() const noexcept {
+            return this->storage == nullptr ? ConstIterator{} : this->storage->entries.cbegin();
+        }
+
+        [[nodiscard]] ConstIterator end() const noexcept {
+            return this->storage == nullptr ? ConstIterator{} : this->storage->entries.cend();
+        }
+    };
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace ionlang {
+    /**
+     * Records spans of the compilation pipeline, and writes them in the
+     * Chrome trace event format (loadable by chrome://tracing and
+     * Perfetto). Disabled by default: while disabled, spans only perform
+     * a single relaxed atomic load.
+     *
+     * Each thread appends to its own buffer without locking. Buffers
+     * are registered once per thread, and are only read when the trace
+     * is written, which must not happen while spans are being recorded.
+     */
+    class TraceRecorder {
+    private:
+        static std::atomic<bool> enabled;
+
+    public:
+        [[nodiscard]] static bool isEnabled() noexcept {
+            return TraceRecorder::enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Enabling the recorder restarts its clock. Recorded spans are
+         * kept until reset.
+         */
+        static void setEnabled(bool enabled) noexcept;
+
+        /**
+         * Discard all recorded spans. Must not be invoked while spans
+         * are being recorded.
+         */
+        static void reset();
+
+        [[nodiscard]] static size_t getEventCount();
+
+        /**
+         * Record a complete span on the calling thread's buffer. The name
+         * must remain valid until the trace is written, such as a string
+         * literal or an interned name.
+         */
+        static void recordSpan(
+            std::string_view name,
+            std::chrono::steady_clock::time_point startTime,
+            std::chrono::steady_clock::time_point endTime,
+            std::string detail
+        );
+
+        /**
+         * Write all recorded spans as a trace event JSON object. Must not
+         * be invoked while spans are being recorded.
+         */
+        static void writeJson(std::ostream& stream);
+    };
+
+    /**
+     * Records the enclosing scope as a span of the provided name, which
+     * must remain valid until the trace is written.
+     */
+    class TraceSpan {
+    private:
+        std::string_view name;
+
+        std::string detail;
+
+        std::optional<std::chrono::steady_clock::time_point> startTime;
+
+    public:
+        explicit TraceSpan(std::string_view name) noexcept;
+
+        ~TraceSpan();
+
+        TraceSpan(const TraceSpan& other) = delete;
+
+        TraceSpan& operator=(const TraceSpan& other) = delete;
+
+        [[nodiscard]] bool isRecording() const noexcept;
+
+        /**
+         * Attach a detail (such as the name of the processed construct)
+         * to the span. Callers should check isRecording() first, to avoid
+         * building the detail needlessly.
+         */
+        void setDetail(std::string detail);
+    };
+}
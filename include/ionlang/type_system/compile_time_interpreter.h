@@ -0,0 +1,155 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <ionlang/construct/expression/call_expr.h>
+#include <ionlang/construct/function.h>
+#include <ionlang/type_system/constant_evaluation.h>
+
+namespace ionlang {
+    struct CompileTimeInterpreterLimits {
+        /**
+         * Statements and expressions which may be evaluated per top-level
+         * call, bounding non-terminating recursion.
+         */
+        size_t maxStepCount = 100'000;
+
+        size_t maxCallDepth = 128;
+
+        /**
+         * Locals (including arguments) which may be alive at once across
+         * all frames, bounding the interpreter's memory.
+         */
+        size_t maxLocalCount = 4096;
+    };
+
+    /**
+     * Evaluates calls to Ion functions upon constant arguments during
+     * compilation, by walking their bodies. A function is evaluable when
+     * its result only depends on its arguments: it may declare, assign and
+     * branch upon locals, and call other evaluable functions, but must not
+     * refer to globals, call externs, or use constructs the interpreter
+     * does not model. Results are memoized per function and arguments,
+     * so a function's body must not change meaning once it was evaluated.
+     * Calls which are not evaluable only because part of a body is not
+     * resolved yet are not memoized, so they may be evaluated once it is.
+     *
+     * The interpreter is not thread-safe. Since it walks the bodies of
+     * other functions, it must also not be used while other threads may
+     * modify them, such as from a function pass run in parallel.
+     */
+    class CompileTimeInterpreter {
+    private:
+        struct CallKey {
+            std::shared_ptr<Function> function;
+
+            std::vector<Constant> arguments;
+
+            bool operator==(const CallKey& other) const noexcept = default;
+        };
+
+        struct CallKeyHash {
+            [[nodiscard]] size_t operator()(const CallKey& callKey) const noexcept;
+        };
+
+        enum struct ExecutionResult {
+            Continue,
+
+            Return,
+
+            /**
+             * The construct is not evaluable, regardless of the limits.
+             */
+            Unsupported,
+
+            /**
+             * Part of the construct (such as a callee or a type) is not
+             * resolved yet, so it may become evaluable later.
+             */
+            Unresolved,
+
+            LimitExceeded
+        };
+
+        struct CallResult {
+            bool isEvaluable;
+
+            /**
+             * Has no value if the function does not return one.
+             */
+            std::optional<Constant> value;
+        };
+
+        CompileTimeInterpreterLimits limits;
+
+        /**
+         * Results of previous calls. Calls which are not evaluable are
+         * memoized too, unless a limit was exceeded, since a later call
+         * starts with a fresh step budget, or something was not resolved.
+         */
+        std::unordered_map<CallKey, CallResult, CallKeyHash> cache;
+
+        /**
+         * Locals of the blocks being executed, innermost last. Frames of
+         * callers are hidden below the index of the current frame's
+         * first scope.
+         */
+        std::vector<std::unordered_map<std::string, Constant>> scopes;
+
+        size_t frameScopeIndex;
+
+        size_t stepCount;
+
+        size_t callDepth;
+
+        size_t localCount;
+
+        std::optional<Constant> returnValue;
+
+        [[nodiscard]] ExecutionResult step() noexcept;
+
+        /**
+         * Find a local of the current frame, searching the innermost
+         * scope first. Returns null if not found.
+         */
+        [[nodiscard]] Constant* findLocal(const std::string& name);
+
+        [[nodiscard]] ExecutionResult declareLocal(const std::string& name, Constant value);
+
+        [[nodiscard]] ExecutionResult evaluateExpression(
+            const std::shared_ptr<Expression<>>& expression,
+            std::optional<Constant>& result
+        );
+
+        /**
+         * Evaluate a call, leaving its result (if any) as the return
+         * value.
+         */
+        [[nodiscard]] ExecutionResult evaluateCall(const std::shared_ptr<CallExpr>& callExpr);
+
+        [[nodiscard]] ExecutionResult executeStatement(const std::shared_ptr<Statement>& statement);
+
+        [[nodiscard]] ExecutionResult executeBlock(const std::shared_ptr<Block>& block);
+
+        [[nodiscard]] ExecutionResult invoke(
+            const std::shared_ptr<Function>& function,
+            const std::vector<Constant>& arguments
+        );
+
+    public:
+        explicit CompileTimeInterpreter(CompileTimeInterpreterLimits limits = {}) noexcept;
+
+        /**
+         * Evaluate a call to the function upon the provided arguments.
+         * Has no value if the function is not evaluable, does not return
+         * a value, or if evaluation exceeded the limits.
+         */
+        [[nodiscard]] std::optional<Constant> call(
+            const std::shared_ptr<Function>& function,
+            const std::vector<Constant>& arguments
+        );
+
+        [[nodiscard]] size_t getCacheSize() const noexcept;
+    };
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <variant>
+#include <ionlang/construct/expression/operation.h>
+#include <ionlang/construct/value/boolean_literal.h>
+#include <ionlang/construct/value/integer_literal.h>
+
+namespace ionlang {
+    /**
+     * An integer value along with its type. The value is always kept
+     * normalized to the type: truncated to its width, then sign extended
+     * if signed, or zero extended otherwise.
+     */
+    struct IntegerConstant {
+        int64_t value;
+
+        IntegerKind integerKind;
+
+        bool isSigned;
+
+        bool operator==(const IntegerConstant& other) const noexcept = default;
+    };
+
+    typedef std::variant<bool, IntegerConstant> Constant;
+}
+
+namespace ionlang::constant_evaluation {
+    /**
+     * Whether integers of the provided kind fit in an integer constant.
+     */
+    [[nodiscard]] bool isRepresentable(IntegerKind integerKind) noexcept;
+
+    /**
+     * Truncate the value to the width of the integer kind, then extend
+     * it back according to its signedness, as two's complement hardware
+     * would.
+     */
+    [[nodiscard]] int64_t normalize(int64_t value, IntegerKind integerKind, bool isSigned) noexcept;
+
+    /**
+     * Find the constant a boolean or integer literal holds. Has no value
+     * for any other expression, or for integers of unrepresentable
+     * kinds.
+     */
+    [[nodiscard]] std::optional<Constant> findConstant(const std::shared_ptr<Expression<>>& expression);
+
+    /**
+     * Convert the constant to a value of the provided type, such as the
+     * declared type of the variable it initializes. Has no value unless
+     * the type is a boolean or integer type of the constant's own kind
+     * and the type can hold the value as is.
+     */
+    [[nodiscard]] std::optional<Constant> convert(
+        const Constant& constant,
+        const std::shared_ptr<Type>& type
+    ) noexcept;
+
+    /**
+     * Whether the expression can be emitted as static data as is: a
+     * literal, or a struct definition whose values are all such
+     * expressions.
+     */
+    [[nodiscard]] bool isStaticInitializer(const std::shared_ptr<Expression<>>& expression);
+
+    /**
+     * Create a literal holding the constant, with its own type.
+     */
+    [[nodiscard]] std::shared_ptr<Expression<>> makeLiteral(const Constant& constant);
+
+    /**
+     * Evaluate an intrinsic operation upon constants, with the semantics
+     * of the code it would be lowered to: integer arithmetic wraps
+     * around, and comparisons and division respect signedness. Has no
+     * value if the operands are not of the same type, if the operator
+     * does not apply to them, or if the result would be undefined
+     * (division by zero, or signed division overflow).
+     */
+    [[nodiscard]] std::optional<Constant> evaluate(
+        IntrinsicOperatorKind operation,
+        const Constant& leftSide,
+        const std::optional<Constant>& rightSide
+    ) noexcept;
+}
@@ -5,10 +5,10 @@
 namespace ionlang {
     std::shared_ptr<Block> Block::make(
         const std::vector<std::shared_ptr<Statement>>& statements,
-        const ionshared::PtrSymbolTable<Construct>& symbolTable
+        ScopeTable<Construct> symbolTable
     ) noexcept {
         std::shared_ptr<Block> result =
-            std::make_shared<Block>(statements, symbolTable);
+            std::make_shared<Block>(statements, std::move(symbolTable));
 
         for (const auto& statement : statements) {
             statement->setParent(result);
@@ -19,10 +19,9 @@ namespace ionlang {
 
     Block::Block(
         std::vector<std::shared_ptr<Statement>> statements,
-        const ionshared::PtrSymbolTable<Construct>& symbolTable
+        ScopeTable<Construct> symbolTable
     ) :
-        Construct(ConstructKind::Block),
-        ionshared::Scoped<Construct, ConstructKind>(symbolTable),
+        ScopedConstruct(ConstructKind::Block, std::move(symbolTable)),
         statements(std::move(statements)) {
         //
     }
@@ -48,7 +47,7 @@ namespace ionlang {
             std::shared_ptr<VariableDeclStmt> variableDecl =
                 statement->dynamicCast<VariableDeclStmt>();
 
-            this->symbolTable->set(variableDecl->name, variableDecl);
+            this->symbolTable.set(variableDecl->name, variableDecl);
         }
 
         // TODO: What about other named statements? Currently there might be none -- but in the future this might be an edge case, it's really daunting to write checks for each named construct (also recall there's Identifier, so we can't just std::dynamic_pointer_cast<ionshared::Named>).
@@ -70,15 +69,34 @@ namespace ionlang {
             return false;
         }
 
-        // TODO: Relocate symbol table entries, but making a map Statement -> Vector<Symbol Table Key>. Remember statement is already registered on the local symbol table on the appendStatement() call.
+        std::shared_ptr<Statement> statement = this->statements[orderIndex];
+
+        this->statements.erase(this->statements.begin() + orderIndex);
+
+        /**
+         * Variable declarations were registered on the local symbol
+         * table when appended, so they must be migrated along.
+         */
+        if (statement->statementKind == StatementKind::VariableDeclaration) {
+            const std::string& name = statement->staticCast<VariableDeclStmt>()->name;
+            ionshared::OptPtr<Construct> localEntry = this->symbolTable.lookup(name);
+
+            if (ionshared::util::hasValue(localEntry) && localEntry->get() == statement.get()) {
+                this->symbolTable.remove(name);
+            }
+        }
 
         /**
          * NOTE: The statement is registered on foreign block's symbol
          * table during this call.
          */
-        target->appendStatement(this->statements[orderIndex]);
+        target->appendStatement(statement);
 
-        this->statements.erase(this->statements.begin() + orderIndex);
+        /**
+         * Re-parenting also updates the cached enclosing constructs of
+         * the statement and its children.
+         */
+        statement->setParent(target);
 
         return true;
     }
@@ -91,10 +109,10 @@ namespace ionlang {
         bool areStatementsEmpty = this->statements.empty();
 
         if (to.has_value()) {
-            if (*to > from) {
-                throw std::out_of_range("To cannot be after from");
+            if (*to < from) {
+                throw std::out_of_range("To cannot be before from");
             }
-            else if (!areStatementsEmpty && *to > this->statements.size() - 1) {
+            else if (*to > this->statements.size()) {
                 throw std::out_of_range("Provided order is outsize of bounds");
             }
         }
@@ -103,14 +121,21 @@ namespace ionlang {
             throw std::out_of_range("Provided order is outsize of bounds");
         }
 
-        size_t statementsRelocated = 0;
+        // Nothing to relocate.
+        if (areStatementsEmpty) {
+            return 0;
+        }
 
-        auto toIterator = to.has_value()
-            ? this->statements.begin() + *to
-            : this->statements.end();
+        size_t statementsRelocated = 0;
+        size_t count = to.value_or(this->statements.size()) - from;
 
-        for (auto i = this->statements.begin() + from; i != toIterator; i++) {
-            if (this->relocateStatement(i - this->statements.begin(), target)) {
+        /**
+         * NOTE: Relocation removes the statement from the local vector,
+         * so the next statement to relocate is always found at the
+         * starting index.
+         */
+        for (size_t i = 0; i < count; i++) {
+            if (this->relocateStatement(from, target)) {
                 statementsRelocated++;
             }
         }
@@ -118,6 +143,65 @@ namespace ionlang {
         return statementsRelocated;
     }
 
+    size_t Block::eraseStatements(size_t from, std::optional<size_t> to) {
+        size_t end = to.value_or(this->statements.size());
+
+        if (end < from || end > this->statements.size()) {
+            throw std::out_of_range("Provided order is outsize of bounds");
+        }
+
+        for (size_t i = from; i < end; i++) {
+            const std::shared_ptr<Statement>& statement = this->statements[i];
+
+            if (statement->statementKind != StatementKind::VariableDeclaration) {
+                continue;
+            }
+
+            const std::string& name = statement->staticCast<VariableDeclStmt>()->name;
+            ionshared::OptPtr<Construct> localEntry = this->symbolTable.lookup(name);
+
+            // Another declaration of the same name may have taken over the entry.
+            if (ionshared::util::hasValue(localEntry) && localEntry->get() == statement.get()) {
+                this->symbolTable.remove(name);
+            }
+        }
+
+        this->statements.erase(
+            this->statements.begin() + static_cast<ptrdiff_t>(from),
+            this->statements.begin() + static_cast<ptrdiff_t>(end)
+        );
+
+        return end - from;
+    }
+
+    void Block::insertStatements(
+        size_t orderIndex,
+        const std::vector<std::shared_ptr<Statement>>& statements
+    ) {
+        if (orderIndex > this->statements.size()) {
+            throw std::out_of_range("Provided order is outsize of bounds");
+        }
+
+        std::shared_ptr<Block> self = this->staticCast<Block>();
+
+        this->statements.insert(
+            this->statements.begin() + static_cast<ptrdiff_t>(orderIndex),
+            statements.begin(),
+            statements.end()
+        );
+
+        for (const auto& statement : statements) {
+            if (statement->statementKind == StatementKind::VariableDeclaration) {
+                std::shared_ptr<VariableDeclStmt> variableDecl =
+                    statement->staticCast<VariableDeclStmt>();
+
+                this->symbolTable.set(variableDecl->name, variableDecl);
+            }
+
+            statement->setParent(self);
+        }
+    }
+
     std::shared_ptr<Block> Block::slice(size_t from, std::optional<size_t> to) {
         std::shared_ptr<Block> newBlock = Block::make();
 
@@ -171,30 +255,8 @@ namespace ionlang {
         return std::nullopt;
     }
 
-    ionshared::OptPtr<Function> Block::findParentFunction() {
-        ionshared::OptPtr<Function> parentFunction = std::nullopt;
-        std::queue<std::shared_ptr<ConstructWithParent<Block>>> childrenOfBlockQueue = {};
-
-        childrenOfBlockQueue.push(this->staticCast<ConstructWithParent<Block>>());
-
-        while (!childrenOfBlockQueue.empty()) {
-            std::shared_ptr<ConstructWithParent<Block>> childOfBlock =
-                childrenOfBlockQueue.front();
-
-            childrenOfBlockQueue.pop();
-
-            std::shared_ptr<Construct> parent = *childOfBlock->getParent();
-
-            if (parent->constructKind == ConstructKind::Function) {
-                parentFunction = parent->dynamicCast<Function>();
-
-                break;
-            }
-            else if (dynamic_cast<ConstructWithParent<Block> *>(parent.get())) {
-                childrenOfBlockQueue.push(parent->dynamicCast<ConstructWithParent<Block>>());
-            }
-        }
-
-        return parentFunction;
+    ionshared::OptPtr<Function> Block::findParentFunction() const noexcept {
+        // NOTE: The enclosing function is cached when the block is attached.
+        return this->findEnclosingFunction();
     }
 }
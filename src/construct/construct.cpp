@@ -2,17 +2,161 @@
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
+    bool EnclosingConstructs::isSameAs(const EnclosingConstructs& other) const noexcept {
+        auto isSameOwner = [](const auto& first, const auto& second) -> bool {
+            return !first.owner_before(second) && !second.owner_before(first);
+        };
+
+        return isSameOwner(this->scope, other.scope)
+            && isSameOwner(this->function, other.function)
+            && isSameOwner(this->module, other.module);
+    }
+
+    // Constructs may be created concurrently, for example by parallel passes.
+    std::atomic<ConstructId> Construct::nextConstructId = 0;
+
+    ConstructId Construct::getConstructIdCount() noexcept {
+        return Construct::nextConstructId.load(std::memory_order_relaxed);
+    }
+
     Construct::Construct(
         ConstructKind kind,
         std::optional<ionshared::SourceLocation> sourceLocation,
         ionshared::OptPtr<Construct> parent
     ) :
+        /**
+         * NOTE: The parent is never handed to the base construct, as
+         * it would hold a strong (owning) reference to it.
+         */
         ionshared::BaseConstruct<Construct, ConstructKind>(
             kind,
             sourceLocation,
-            std::move(parent)
-        ) {
-        //
+            std::nullopt
+        ),
+        constructId(Construct::nextConstructId.fetch_add(1, std::memory_order_relaxed)),
+        weakParent(),
+        enclosingConstructs() {
+#ifdef IONLANG_MEMORY_TRACKING
+        MemoryTracker::recordAllocation(
+            MemorySubject::Construct,
+            static_cast<uint32_t>(kind),
+            MemoryTracker::findShallowSize(MemorySubject::Construct, static_cast<uint32_t>(kind))
+        );
+#endif
+
+        if (ionshared::util::hasValue(parent)) {
+            this->weakParent = *parent;
+
+            /**
+             * NOTE: Only the local links can be computed at this point,
+             * since children are not yet available during construction.
+             */
+            this->Construct::refreshEnclosingConstructs();
+        }
+    }
+
+#ifdef IONLANG_MEMORY_TRACKING
+    Construct::~Construct() {
+        uint32_t constructKind = static_cast<uint32_t>(this->constructKind);
+
+        MemoryTracker::recordRelease(
+            MemorySubject::Construct,
+            constructKind,
+            MemoryTracker::findShallowSize(MemorySubject::Construct, constructKind)
+        );
+
+        if (this->memorySubject != MemorySubject::Construct) {
+            MemoryTracker::recordRelease(
+                this->memorySubject,
+                this->memoryKind,
+                MemoryTracker::findShallowSize(this->memorySubject, this->memoryKind)
+            );
+        }
+    }
+
+    void Construct::trackMemorySubject(MemorySubject subject, uint32_t kind) noexcept {
+        this->memorySubject = subject;
+        this->memoryKind = kind;
+
+        MemoryTracker::recordAllocation(
+            subject,
+            kind,
+            MemoryTracker::findShallowSize(subject, kind)
+        );
+    }
+#endif
+
+    void Construct::setParent(std::optional<std::shared_ptr<Construct>> parent) noexcept {
+        this->weakParent = ionshared::util::hasValue(parent)
+            ? std::weak_ptr<Construct>(*parent)
+            : std::weak_ptr<Construct>();
+
+        this->refreshEnclosingConstructs();
+    }
+
+    ionshared::OptPtr<Construct> Construct::getParent() const noexcept {
+        if (std::shared_ptr<Construct> parent = this->weakParent.lock()) {
+            return parent;
+        }
+
+        return std::nullopt;
+    }
+
+    std::shared_ptr<Construct> Construct::forceGetParent() const {
+        std::shared_ptr<Construct> parent = this->weakParent.lock();
+
+        if (parent == nullptr) {
+            throw std::runtime_error("Parent is not set or was already released");
+        }
+
+        return parent;
+    }
+
+    bool Construct::isRootNode() const noexcept {
+        return this->weakParent.expired();
+    }
+
+    void Construct::refreshEnclosingConstructs() noexcept {
+        EnclosingConstructs enclosingConstructs{};
+        ionshared::OptPtr<Construct> parentResult = this->getParent();
+
+        if (ionshared::util::hasValue(parentResult)) {
+            const std::shared_ptr<Construct>& parent = *parentResult;
+
+            // Inherit the parent's links, then override them with the parent itself where applicable.
+            enclosingConstructs = parent->enclosingConstructs;
+
+            if (parent->isScope()) {
+                enclosingConstructs.scope = std::static_pointer_cast<ScopedConstruct>(parent);
+            }
+
+            if (parent->constructKind == ConstructKind::Function) {
+                enclosingConstructs.function = std::static_pointer_cast<Function>(parent);
+            }
+            else if (parent->constructKind == ConstructKind::Module) {
+                enclosingConstructs.module = std::static_pointer_cast<Module>(parent);
+            }
+        }
+
+        // Nothing changed, so neither did the links of any descendant.
+        if (enclosingConstructs.isSameAs(this->enclosingConstructs)) {
+            return;
+        }
+
+        this->enclosingConstructs = std::move(enclosingConstructs);
+
+        for (const auto& child : this->getChildNodes()) {
+            ionshared::OptPtr<Construct> childParent = child->getParent();
+
+            // Shared constructs (such as types) may be owned elsewhere.
+            if (ionshared::util::hasValue(childParent) && childParent->get() == this) {
+                child->refreshEnclosingConstructs();
+            }
+        }
+    }
+
+    bool Construct::isScope() const noexcept {
+        return false;
     }
 
     Ast Construct::getChildNodes() {
@@ -36,26 +180,40 @@ namespace ionlang {
         return Const::findConstructKindName(this->constructKind);
     }
 
-    void ScopedConstruct::setParent(std::optional<std::shared_ptr<Construct>> parent) noexcept {
-        BaseConstruct::setParent(parent);
+    ionshared::OptPtr<ScopedConstruct> Construct::findEnclosingScope() const noexcept {
+        if (std::shared_ptr<ScopedConstruct> scope = this->enclosingConstructs.scope.lock()) {
+            return scope;
+        }
 
-        if (!ionshared::util::hasValue(parent)) {
-            return;
+        return std::nullopt;
+    }
+
+    ionshared::OptPtr<Function> Construct::findEnclosingFunction() const noexcept {
+        if (std::shared_ptr<Function> function = this->enclosingConstructs.function.lock()) {
+            return function;
         }
 
-        this->traverseParents([&](auto parent) -> bool {
-            /**
-             * NOTE: Optional wrapper is used for compatibility, in this case
-             * it should always contain a value if the cast succeeds.
-             */
-            if (std::optional<std::shared_ptr<Scoped>> scopedParent =
-                std::dynamic_pointer_cast<Scoped>(parent)) {
-                this->parentScope = *scopedParent;
+        return std::nullopt;
+    }
 
-                return false;
-            }
+    ionshared::OptPtr<Module> Construct::findEnclosingModule() const noexcept {
+        if (std::shared_ptr<Module> module = this->enclosingConstructs.module.lock()) {
+            return module;
+        }
+
+        return std::nullopt;
+    }
 
-            return true;
-        });
+    ScopedConstruct::ScopedConstruct(
+        ConstructKind kind,
+        ScopeTable<Construct> symbolTable
+    ) :
+        Construct(kind),
+        symbolTable(std::move(symbolTable)) {
+        //
+    }
+
+    bool ScopedConstruct::isScope() const noexcept {
+        return true;
     }
 }
@@ -35,8 +35,12 @@ namespace ionlang {
     }
 
     Ast CallExpr::getChildNodes() {
-        return {
-            this->calleeResolvable
-        };
+        Ast children{this->calleeResolvable};
+
+        for (const auto& argument : this->arguments) {
+            children.push_back(argument);
+        }
+
+        return children;
     }
 }
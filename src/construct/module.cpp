@@ -1,6 +1,12 @@
 #include <ionlang/passes/pass.h>
+#include <ionlang/tracking/ast_reclaimer.h>
 
 namespace ionlang {
+    Context::Context(Scope globalScope) noexcept :
+        globalScope(std::move(globalScope)) {
+        //
+    }
+
     Module::Module(std::string id, std::shared_ptr<Context> context) :
         Construct(ConstructKind::Module),
         ionshared::Named{std::move(id)},
@@ -8,6 +14,10 @@ namespace ionlang {
         //
     }
 
+    Module::~Module() {
+        AstReclaimer::getGlobal().reclaim(std::move(this->context));
+    }
+
     void Module::accept(Pass& visitor) {
         visitor.visitModule(this->dynamicCast<Module>());
     }
@@ -22,7 +22,7 @@ namespace ionlang {
         std::shared_ptr<ArgumentList> argumentList,
         PtrResolvable<Type> returnType
     ) :
-        Construct(ConstructKind::Prototype),
+        ScopedConstruct(ConstructKind::Prototype),
         Named{std::move(name)},
         argumentList(std::move(argumentList)),
         returnType(std::move(returnType)) {
@@ -65,9 +65,7 @@ namespace ionlang {
             << IONLANG_MANGLE_SEPARATOR
             << this->name;
 
-        auto argumentListNativeMap = this->argumentList->symbolTable->unwrap();
-
-        for (const auto& [name, construct] : argumentListNativeMap) {
+        for (const auto& [name, construct] : this->argumentList->symbolTable) {
             if (construct->constructKind != ConstructKind::Resolvable) {
                 continue;
             }
@@ -2,15 +2,13 @@
 
 namespace ionlang {
     std::shared_ptr<ArgumentList> ArgumentList::make(
-        const ionshared::PtrSymbolTable<Construct>& symbolTable,
+        ScopeTable<Construct> symbolTable,
         bool isVariable
     ) noexcept {
         std::shared_ptr<ArgumentList> result =
-            std::make_shared<ArgumentList>(symbolTable, isVariable);
+            std::make_shared<ArgumentList>(std::move(symbolTable), isVariable);
 
-        auto itemsNativeMap = symbolTable->unwrap();
-
-        for (const auto& [name, construct] : itemsNativeMap) {
+        for (const auto& [name, construct] : result->symbolTable) {
             construct->setParent(result);
         }
 
@@ -18,11 +16,10 @@ namespace ionlang {
     }
 
     ArgumentList::ArgumentList(
-        const ionshared::PtrSymbolTable<Construct>& symbolTable,
+        ScopeTable<Construct> symbolTable,
         bool isVariable
     ) :
-        Construct(ConstructKind::ArgumentList),
-        ionshared::Scoped<Construct, ConstructKind>(symbolTable),
+        ScopedConstruct(ConstructKind::ArgumentList, std::move(symbolTable)),
         isVariable(isVariable) {
         //
     }
@@ -32,13 +29,6 @@ namespace ionlang {
     }
 
     Ast ArgumentList::getChildNodes() {
-        Ast children{};
-        auto symbolTableNativeMap = this->symbolTable->unwrap();
-
-        for (const auto& [name, type] : symbolTableNativeMap) {
-            children.push_back(type);
-        }
-
-        return children;
+        return Construct::convertChildren(this->symbolTable);
     }
 }
@@ -8,7 +8,7 @@ namespace ionlang {
         ConstructWithParent<Block, Construct, ConstructKind>(ConstructKind::Statement),
         statementKind(kind),
         yields(std::move(yields)) {
-        //
+        this->trackMemorySubject(MemorySubject::Statement, static_cast<uint32_t>(kind));
     }
 
     bool Statement::isTerminal() const noexcept {
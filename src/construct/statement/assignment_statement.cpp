@@ -29,7 +29,8 @@ namespace ionlang {
 
     Ast AssignmentStmt::getChildNodes() {
         return {
-            this->variableDeclStmtRef
+            this->variableDeclStmtRef,
+            this->value
         };
     }
 }
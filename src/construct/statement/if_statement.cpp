@@ -36,8 +36,16 @@ namespace ionlang {
     }
 
     Ast IfStmt::getChildNodes() {
-        // TODO: Children should also include the blocks (which ARE created by the if statement?)?
-        return {this->condition};
+        Ast children{
+            this->condition,
+            this->consequentBlock
+        };
+
+        if (this->hasAlternativeBlock()) {
+            children.push_back(*this->alternativeBlock);
+        }
+
+        return children;
     }
 
     bool IfStmt::hasAlternativeBlock() const noexcept {
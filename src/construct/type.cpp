@@ -5,12 +5,12 @@ namespace ionlang {
     Type::Type(
         std::string name,
         TypeKind kind,
-        std::shared_ptr<TypeQualifierSet> qualifiers
+        TypeQualifiers qualifiers
     ) noexcept :
         Construct(ConstructKind::Type),
-        typeName(name),
+        typeName(std::move(name)),
         typeKind(kind),
-        qualifiers(std::move(qualifiers)) {
-        //
+        qualifiers(qualifiers) {
+        this->trackMemorySubject(MemorySubject::Type, static_cast<uint32_t>(kind));
     }
 }
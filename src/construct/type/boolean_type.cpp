@@ -3,8 +3,8 @@
 #include <ionlang/passes/pass.h>
 
 namespace ionlang {
-    BooleanType::BooleanType(std::shared_ptr<TypeQualifierSet> qualifiers) :
-        Type(const_name::typeBool, TypeKind::Boolean, std::move(qualifiers)) {
+    BooleanType::BooleanType(TypeQualifiers qualifiers) :
+        Type(const_name::typeBool, TypeKind::Boolean, qualifiers) {
         //
     }
 
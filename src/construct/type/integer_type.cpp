@@ -5,9 +5,9 @@ namespace ionlang {
     IntegerType::IntegerType(
         IntegerKind kind,
         bool isSigned,
-        std::shared_ptr<TypeQualifierSet> qualifiers
+        TypeQualifiers qualifiers
     ) :
-        Type(util::resolveIntegerKindName(kind), TypeKind::Integer, std::move(qualifiers)),
+        Type(util::resolveIntegerKindName(kind), TypeKind::Integer, qualifiers),
         integerKind(kind),
         isSigned(isSigned) {
         //
@@ -3,21 +3,17 @@
 namespace ionlang {
     std::shared_ptr<StructType> StructType::make(
         const std::string& name,
-        const Fields& fields,
-        const ionshared::PtrSymbolTable<Method>& methods
+        Fields fields,
+        Methods methods
     ) noexcept {
         std::shared_ptr<StructType> result =
-            std::make_shared<StructType>(name, fields, methods);
-
-        auto fieldsNativeMap = fields->unwrap();
+            std::make_shared<StructType>(name, std::move(fields), std::move(methods));
 
-        for (const auto& [name, type] : fieldsNativeMap) {
+        for (const auto& [name, type] : result->fields) {
             type->setParent(result);
         }
 
-        auto methodsNativeMap = methods->unwrap();
-
-        for (const auto& [name, method] : methodsNativeMap) {
+        for (const auto& [name, method] : result->methods) {
             method->setParent(result);
         }
 
@@ -27,7 +23,7 @@ namespace ionlang {
     StructType::StructType(
         std::string name,
         Fields fields,
-        ionshared::PtrSymbolTable<Method> methods
+        Methods methods
     ) :
         ConstructWithParent<Module, Type, std::string, TypeKind>(std::move(name), TypeKind::Struct),
         fields(std::move(fields)),
@@ -40,14 +36,7 @@ namespace ionlang {
     }
 
     Ast StructType::getChildNodes() {
-        Ast children = {};
-        auto fieldsMap = this->fields->unwrap();
-
         // TODO: What about the field name?
-        for (const auto &[name, type] : fieldsMap) {
-            children.push_back(type);
-        }
-
-        return children;
+        return Construct::convertChildren(this->fields);
     }
 }
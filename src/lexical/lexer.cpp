@@ -3,6 +3,9 @@
 #define IONLANG_LEXER_INDEX_DEFAULT 0
 
 #include <ionlang/lexical/lexer.h>
+#include <ionlang/tracking/compile_profiler.h>
+#include <ionlang/tracking/trace_recorder.h>
+#include <ionlang/tracking/memory_tracker.h>
 
 namespace ionlang {
     Lexer::Lexer(const std::string &input) :
@@ -235,6 +238,9 @@ namespace ionlang {
     }
 
     std::vector<Token> Lexer::scan() {
+        PhaseTimer timer{"lexing"};
+        TraceSpan span{"Lexer::scan"};
+
         // Reset index to avoid carrying over previous information.
         this->begin();
 
@@ -253,6 +259,15 @@ namespace ionlang {
             tokens.push_back(*token);
         }
 
+        MemoryTracker::recordCreation(
+            MemorySubject::Token,
+            0,
+            tokens.size(),
+            tokens.size() * sizeof(Token)
+        );
+
+        timer.setUnits("tokens", tokens.size());
+
         return tokens;
     }
 }
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <ionlang/misc/work_stealing_pool.h>
+
+namespace ionlang {
+    WorkStealingPool::WorkStealingPool(size_t workerCount) :
+        workers(),
+        threads(),
+        mutex(),
+        batchCondition(),
+        doneCondition(),
+        callback(nullptr),
+        batchGeneration(0),
+        activeThreadCount(0),
+        isStopping(false),
+        remainingTaskCount(0) {
+        if (workerCount == 0) {
+            workerCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        }
+
+        for (size_t i = 0; i < workerCount; i++) {
+            this->workers.push_back(std::make_unique<Worker>());
+        }
+
+        // The first worker is the thread invoking run().
+        for (size_t i = 1; i < workerCount; i++) {
+            this->threads.emplace_back(&WorkStealingPool::runThread, this, i);
+        }
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock{this->mutex};
+
+            this->isStopping = true;
+        }
+
+        this->batchCondition.notify_all();
+
+        for (auto& thread : this->threads) {
+            thread.join();
+        }
+    }
+
+    std::optional<size_t> WorkStealingPool::takeTask(size_t workerIndex) {
+        {
+            Worker& worker = *this->workers[workerIndex];
+            std::lock_guard<std::mutex> lock{worker.mutex};
+
+            if (!worker.tasks.empty()) {
+                size_t task = worker.tasks.back();
+
+                worker.tasks.pop_back();
+
+                return task;
+            }
+        }
+
+        // Steal from the other end, to disturb the owner the least.
+        for (size_t i = 1; i < this->workers.size(); i++) {
+            Worker& victim = *this->workers[(workerIndex + i) % this->workers.size()];
+            std::lock_guard<std::mutex> lock{victim.mutex};
+
+            if (!victim.tasks.empty()) {
+                size_t task = victim.tasks.front();
+
+                victim.tasks.pop_front();
+
+                return task;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void WorkStealingPool::runTasks(size_t workerIndex) {
+        while (std::optional<size_t> task = this->takeTask(workerIndex)) {
+            (*this->callback)(*task, workerIndex);
+
+            if (this->remainingTaskCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock{this->mutex};
+
+                this->doneCondition.notify_all();
+            }
+        }
+    }
+
+    void WorkStealingPool::runThread(size_t workerIndex) {
+        uint64_t lastBatchGeneration = 0;
+        std::unique_lock<std::mutex> lock{this->mutex};
+
+        while (true) {
+            this->batchCondition.wait(lock, [&, this] {
+                return this->isStopping || this->batchGeneration != lastBatchGeneration;
+            });
+
+            if (this->isStopping) {
+                return;
+            }
+
+            lastBatchGeneration = this->batchGeneration;
+            this->activeThreadCount++;
+            lock.unlock();
+            this->runTasks(workerIndex);
+            lock.lock();
+            this->activeThreadCount--;
+
+            if (this->activeThreadCount == 0) {
+                this->doneCondition.notify_all();
+            }
+        }
+    }
+
+    size_t WorkStealingPool::getWorkerCount() const noexcept {
+        return this->workers.size();
+    }
+
+    void WorkStealingPool::run(size_t taskCount, const TaskCallback& callback) {
+        if (taskCount == 0) {
+            return;
+        }
+
+        size_t workerCount = this->workers.size();
+
+        {
+            std::lock_guard<std::mutex> lock{this->mutex};
+
+            /**
+             * NOTE: The callback and task count must be set before any task
+             * is published, since a thread which is late from a previous
+             * batch may already be looking for tasks to steal.
+             */
+            this->callback = &callback;
+            this->remainingTaskCount.store(taskCount, std::memory_order_release);
+            this->batchGeneration++;
+
+            // Hand out contiguous ranges of tasks, in order.
+            for (size_t i = 0; i < workerCount; i++) {
+                Worker& worker = *this->workers[i];
+                std::lock_guard<std::mutex> workerLock{worker.mutex};
+                size_t rangeStart = taskCount * i / workerCount;
+                size_t rangeEnd = taskCount * (i + 1) / workerCount;
+
+                // Stored in reverse, so that the owner processes its range front to back.
+                for (size_t task = rangeEnd; task > rangeStart; task--) {
+                    worker.tasks.push_back(task - 1);
+                }
+            }
+        }
+
+        this->batchCondition.notify_all();
+        this->runTasks(0);
+
+        std::unique_lock<std::mutex> lock{this->mutex};
+
+        /**
+         * Threads which joined the batch late may still be looking for
+         * tasks to steal, and must be done before the callback goes away.
+         */
+        this->doneCondition.wait(lock, [this] {
+            return this->remainingTaskCount.load(std::memory_order_acquire) == 0
+                && this->activeThreadCount == 0;
+        });
+
+        this->callback = nullptr;
+    }
+}
@@ -0,0 +1,52 @@
+#include <ionlang/passes/fused_pass.h>
+
+namespace ionlang {
+    FusedPass::FusedPass(
+        std::shared_ptr<ionshared::PassContext> context,
+        std::vector<std::shared_ptr<Pass>> passes
+    ) noexcept :
+        Pass(std::move(context)),
+        passes(std::move(passes)) {
+        //
+    }
+
+    void FusedPass::enterConstruct(const std::shared_ptr<Construct>& construct) {
+        for (size_t i = 0; i < this->passes.size(); i++) {
+            try {
+                this->passes[i]->enterConstruct(construct);
+            }
+            catch (...) {
+                for (size_t j = 0; j < i; j++) {
+                    this->passes[j]->abortConstruct(construct);
+                }
+
+                throw;
+            }
+        }
+    }
+
+    void FusedPass::leaveConstruct(const std::shared_ptr<Construct>& construct) {
+        for (size_t i = 0; i < this->passes.size(); i++) {
+            try {
+                this->passes[i]->leaveConstruct(construct);
+            }
+            catch (...) {
+                for (size_t j = i + 1; j < this->passes.size(); j++) {
+                    this->passes[j]->abortConstruct(construct);
+                }
+
+                throw;
+            }
+        }
+    }
+
+    void FusedPass::abortConstruct(const std::shared_ptr<Construct>& construct) {
+        for (const auto& pass : this->passes) {
+            pass->abortConstruct(construct);
+        }
+    }
+
+    const std::vector<std::shared_ptr<Pass>>& FusedPass::getPasses() const noexcept {
+        return this->passes;
+    }
+}
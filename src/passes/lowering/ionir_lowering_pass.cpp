@@ -1,3 +1,5 @@
+#include <exception>
+#include <utility>
 #include <ionshared/misc/util.h>
 #include <ionir/construct/value/integer_literal.h>
 #include <ionir/construct/value/char_literal.h>
@@ -14,85 +16,541 @@
 #include <ionir/misc/inst_builder.h>
 #include <ionlang/construct/statement/return_statement.h>
 #include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/passes/construct_dispatch.h>
+#include <ionlang/passes/static_pass.h>
 #include <ionlang/diagnostics/diagnostic.h>
 #include <ionlang/const/const.h>
 #include <ionlang/misc/util.h>
+#include <ionlang/tracking/ast_reclaimer.h>
+#include <ionlang/tracking/compile_profiler.h>
+#include <ionlang/tracking/trace_recorder.h>
+#include <ionlang/tracking/memory_tracker.h>
+#include <ionlang/type_system/constant_evaluation.h>
 
 namespace ionlang {
+    /**
+     * Collects the declarations of the locals assigned to within a tree.
+     */
+    struct AssignedVariableDeclCollector : StaticPass<AssignedVariableDeclCollector> {
+        std::unordered_set<const VariableDeclStmt*>& assignedVariableDecls;
+
+        explicit AssignedVariableDeclCollector(
+            std::unordered_set<const VariableDeclStmt*>& assignedVariableDecls
+        ) noexcept :
+            assignedVariableDecls(assignedVariableDecls) {
+            //
+        }
+
+        void visitAssignmentStmt(const std::shared_ptr<AssignmentStmt>& construct) {
+            ionshared::OptPtr<VariableDeclStmt> variableDecl =
+                construct->variableDeclStmtRef->getValue();
+
+            if (ionshared::util::hasValue(variableDecl)) {
+                this->assignedVariableDecls.insert(variableDecl->get());
+            }
+        }
+    };
+
+    /**
+     * Whether a local may be bound directly to the lowered value of its
+     * initializer, which must then be a constant or an instruction which
+     * was already emitted. Another local's stack slot would be aliased
+     * rather than read, and an operation value is only materialized where
+     * it is used.
+     */
+    static bool isPromotableValue(const std::shared_ptr<ionir::Construct>& irValue) {
+        if (irValue->dynamicCast<ionir::Inst>() != nullptr) {
+            return irValue->dynamicCast<ionir::AllocaInst>() == nullptr;
+        }
+
+        return irValue->dynamicCast<ionir::OperationValue>() == nullptr;
+    }
+
+    template<typename T>
+    static void popAbove(ionshared::Stack<T>& stack, size_t size) {
+        while (stack.getSize() > size) {
+            stack.forcePop();
+        }
+    }
+
+    /**
+     * Pack the structural identity of a non-struct type. The detail
+     * distinguishes types of the same kind, such as integer widths.
+     */
+    static uint32_t makeTypeKey(TypeKind typeKind, uint32_t detail, TypeQualifiers qualifiers) {
+        return static_cast<uint32_t>(typeKind) << 24
+            | detail << TypeQualifiers::qualifierCount
+            | qualifiers.getFlags();
+    }
+
     std::shared_ptr<ionir::InstBuilder> IonIrLoweringPass::IonIrBuffers::makeBuilder() {
         return this->basicBlocks.forceGetTopItem()->createBuilder();
     }
 
-    std::shared_ptr<ionir::Type> IonIrLoweringPass::processTypeQualifiers(
-        std::shared_ptr<ionir::Type> type,
-        const std::shared_ptr<TypeQualifierSet>& qualifiers
+    IonIrLoweringPass::IonIrBuffers::Checkpoint IonIrLoweringPass::IonIrBuffers::makeCheckpoint() const {
+        return Checkpoint{
+            this->modules.getSize(),
+            this->functions.getSize(),
+            this->basicBlocks.getSize(),
+            this->globalScopes.getSize()
+        };
+    }
+
+    void IonIrLoweringPass::IonIrBuffers::restore(const Checkpoint& checkpoint) {
+        if (this->modules.getSize() < checkpoint.moduleCount
+            || this->functions.getSize() < checkpoint.functionCount
+            || this->basicBlocks.getSize() < checkpoint.basicBlockCount
+            || this->globalScopes.getSize() < checkpoint.globalScopeCount) {
+            // TODO: Use DiagnosticBuilder.
+            throw std::runtime_error("Cannot restore buffers: A buffer was popped below its checkpoint");
+        }
+
+        popAbove(this->modules, checkpoint.moduleCount);
+        popAbove(this->functions, checkpoint.functionCount);
+        popAbove(this->basicBlocks, checkpoint.basicBlockCount);
+        popAbove(this->globalScopes, checkpoint.globalScopeCount);
+    }
+
+    const std::array<
+        std::optional<ionir::TypeQualifier>,
+        TypeQualifiers::qualifierCount
+    > IonIrLoweringPass::irTypeQualifierMap{
+        ionir::TypeQualifier::Constant,
+        ionir::TypeQualifier::Mutable,
+        ionir::TypeQualifier::Reference,
+        ionir::TypeQualifier::Pointer,
+
+        // Nullable.
+        std::nullopt
+    };
+
+    uint32_t IonIrLoweringPass::getNameCounter() noexcept {
+        return this->nameCounter++;
+    }
+
+    void IonIrLoweringPass::declareFunction(const std::shared_ptr<Function>& function) {
+        std::shared_ptr<ionir::Module> irModuleBuffer =
+            this->irBuffers.modules.forceGetTopItem();
+
+        std::shared_ptr<ConcurrentScopeTable<ionir::Construct>> irGlobalScope =
+            this->irBuffers.globalScopes.forceGetTopItem();
+
+        std::shared_ptr<ionir::Prototype> irPrototype =
+            this->safeEarlyVisitOrLookup<ionir::Prototype>(function->prototype);
+
+        /**
+         * The function's body will be filled when visiting the body. The
+         * visit body function will detect that the block being visited is
+         * a function body, and will set the buffered function (this function)'s
+         * body with the newly created one.
+         */
+        std::shared_ptr<ionir::Function> irFunction = ionir::Function::make(
+            irPrototype,
+            std::vector<std::shared_ptr<ionir::BasicBlock>>{}
+        );
+
+        irFunction->setParent(irModuleBuffer);
+
+        if (!irGlobalScope->set(function->prototype->name, irFunction)) {
+            this->context->diagnosticBuilder
+                ->bootstrap(diagnostic::functionRedefinition)
+                ->formatMessage(function->prototype->name)
+                ->finish();
+
+            // TODO
+            throw std::runtime_error("Awaiting diagnostics implementation during lowering");
+        }
+
+        irModuleBuffer->insertFunction(irFunction);
+        this->symbolTable.set(*function, irFunction);
+    }
+
+    void IonIrLoweringPass::lowerFunctionBody(const std::shared_ptr<Function>& function) {
+        FunctionTimer timer{function};
+        TraceSpan span{"IonIrLoweringPass::lowerFunctionBody"};
+
+        if (span.isRecording()) {
+            span.setDetail(function->prototype->name);
+        }
+
+        const std::shared_ptr<ionir::Construct>& irConstruct = this->symbolTable.find(*function);
+
+        if (irConstruct == nullptr) {
+            throw std::runtime_error("Function must be declared before its body is lowered");
+        }
+
+        std::shared_ptr<ionir::Function> irFunction = irConstruct->staticCast<ionir::Function>();
+
+        /**
+         * Functions may be lowered from within another function's body
+         * when visited on their own, so the enclosing function's assigned
+         * locals are restored afterwards.
+         */
+        std::optional<std::unordered_set<const VariableDeclStmt*>> callerAssignedVariableDecls =
+            std::move(this->assignedVariableDecls);
+
+        this->assignedVariableDecls = std::nullopt;
+
+        if (this->options.promoteImmutableLocals) {
+            AssignedVariableDeclCollector assignedVariableDeclCollector{
+                this->assignedVariableDecls.emplace()
+            };
+
+            assignedVariableDeclCollector.visit(function->body);
+        }
+
+        this->irBuffers.functions.push(irFunction);
+        this->visit(function->body);
+        this->irBuffers.functions.forcePop();
+        this->assignedVariableDecls = std::move(callerAssignedVariableDecls);
+    }
+
+    void IonIrLoweringPass::streamFunctionBody(const std::shared_ptr<Function>& function) {
+        /**
+         * Lowering results created for the body are only reachable from
+         * the symbol table once the body is released, including those
+         * of constructs created during lowering, such as split blocks.
+         * The journal records all of them, wherever they came from.
+         */
+        std::shared_ptr<ionir::Function> irFunction;
+
+        // Rolled back even if lowering or the sink fails, so that no result is left behind.
+        {
+            ConstructTableJournal<ionir::Construct> journal{this->symbolTable};
+
+            this->lowerFunctionBody(function);
+            irFunction = this->symbolTable.find(*function)->staticCast<ionir::Function>();
+            (*this->options.functionSink)(function, irFunction);
+        }
+
+        // Keep the declarations: callers lowered later still refer to them.
+        irFunction->basicBlocks.clear();
+
+        std::shared_ptr<Block> body = std::exchange(function->body, Block::make());
+
+        function->body->setParent(function);
+        AstReclaimer::getGlobal().reclaim(std::move(body));
+    }
+
+    void IonIrLoweringPass::lowerFunctionBodiesInParallel(
+        const std::vector<std::shared_ptr<Construct>>& topLevelConstructs,
+        const std::vector<std::shared_ptr<Function>>& functions
     ) {
-        std::shared_ptr<ionir::TypeQualifiers> irTypeQualifiers =
-            std::make_shared<ionir::TypeQualifiers>();
+        WorkStealingPool& workStealingPool = **this->options.workStealingPool;
 
-        auto typeQualifiersSet = qualifiers->unwrap();
+        std::shared_ptr<ionir::Module> irModuleBuffer =
+            this->irBuffers.modules.forceGetTopItem();
 
-        for (const auto &typeQualifier : typeQualifiersSet) {
-            ionir::TypeQualifier irTypeQualifier;
+        std::shared_ptr<ConcurrentScopeTable<ionir::Construct>> irGlobalScope =
+            this->irBuffers.globalScopes.forceGetTopItem();
 
-            switch (typeQualifier) {
-                case TypeQualifier::Pointer: {
-                    irTypeQualifier = ionir::TypeQualifier::Pointer;
+        // Pass instances of each worker, created by the worker upon its first task.
+        std::vector<std::unique_ptr<IonIrLoweringPass>> workerPasses(
+            workStealingPool.getWorkerCount()
+        );
+
+        // Errors, indexed by function.
+        std::vector<std::exception_ptr> errors(functions.size());
+
+        workStealingPool.run(functions.size(), [&, this](size_t taskIndex, size_t workerIndex) {
+            try {
+                std::unique_ptr<IonIrLoweringPass>& workerPass = workerPasses[workerIndex];
+
+                if (workerPass == nullptr) {
+                    // Workers lower their bodies serially, and never stream them.
+                    workerPass = std::make_unique<IonIrLoweringPass>(
+                        this->context,
+                        this->modules,
+
+                        LoweringOptions{
+                            .useLinearBodies = this->options.useLinearBodies,
+                            .promoteImmutableLocals = this->options.promoteImmutableLocals
+                        }
+                    );
+
+                    workerPass->irBuffers.modules.push(irModuleBuffer);
+                    workerPass->irBuffers.globalScopes.push(irGlobalScope);
+
+                    // Types are shared, so that each is lowered once per module.
+                    workerPass->irTypeCache = this->irTypeCache;
+
+                    /**
+                     * Top-level entities are shared too, and are no longer
+                     * modified. Everything else is lowered by each worker
+                     * on its own, so that workers never write to the same
+                     * IonIR construct.
+                     */
+                    for (const auto& topLevelConstruct : topLevelConstructs) {
+                        workerPass->symbolTable.set(
+                            *topLevelConstruct,
+                            this->symbolTable.find(*topLevelConstruct)
+                        );
+                    }
+                }
+
+                workerPass->lowerFunctionBody(functions[taskIndex]);
+            }
+            catch (...) {
+                errors[taskIndex] = std::current_exception();
+            }
+        });
+
+        // Report the error of the first function in declaration order, regardless of timing.
+        for (const auto& error : errors) {
+            if (error != nullptr) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    bool IonIrLoweringPass::requiresStackSlot(const VariableDeclStmt* variableDecl) const noexcept {
+        /**
+         * There is no address-of operator, so a local's address can only
+         * be observed through assignments.
+         */
+        return !this->assignedVariableDecls.has_value()
+            || this->assignedVariableDecls->contains(variableDecl);
+    }
+
+    void IonIrLoweringPass::lowerLinearBody(const LinearBody& linearBody) {
+        std::shared_ptr<ionir::InstBuilder> irInstBuilder =
+            this->irBuffers.makeBuilder();
+
+        // Lowered value of each node, indexed by node index.
+        std::vector<std::shared_ptr<ionir::Construct>> irValues(linearBody.nodes.size());
+
+        size_t variableDeclIndex = 0;
+
+        for (size_t i = 0; i < linearBody.nodes.size(); i++) {
+            const LinearNode& node = linearBody.nodes[i];
+
+            switch (node.kind) {
+                case LinearNodeKind::IntegerLiteral: {
+                    const std::shared_ptr<Type>& integerType = linearBody.types[node.second];
+
+                    if (integerType->typeKind != TypeKind::Integer) {
+                        throw std::runtime_error("Integer value's type must be integer type");
+                    }
+
+                    irValues[i] = ionir::IntegerLiteral::make(
+                        this->safeEarlyVisitOrLookup<ionir::IntegerType>(integerType),
+                        linearBody.integers[node.first]
+                    );
+
+                    break;
+                }
+
+                case LinearNodeKind::BooleanLiteral: {
+                    irValues[i] = std::make_shared<ionir::BooleanLiteral>(node.payload != 0);
+
+                    break;
+                }
+
+                case LinearNodeKind::CharLiteral: {
+                    irValues[i] = std::make_shared<ionir::CharLiteral>(
+                        static_cast<char>(node.payload)
+                    );
+
+                    break;
+                }
+
+                case LinearNodeKind::StringLiteral: {
+                    irValues[i] = std::make_shared<ionir::StringLiteral>(
+                        linearBody.strings[node.first]
+                    );
 
                     break;
                 }
 
-                case TypeQualifier::Reference: {
-                    irTypeQualifier = ionir::TypeQualifier::Reference;
+                case LinearNodeKind::VariableRef: {
+                    irValues[i] = node.hasFlag(LinearNodeFlag::External)
+                        ? this->safeEarlyVisitOrLookup<ionir::Value<>>(linearBody.externals[node.first], false)
+                        : irValues[node.first];
 
                     break;
                 }
 
-                case TypeQualifier::Constant: {
-                    irTypeQualifier = ionir::TypeQualifier::Constant;
+                case LinearNodeKind::Operation: {
+                    std::optional<ionir::OperatorKind> irOperatorKindResult =
+                        util::findIonIrOperatorKind(
+                            static_cast<IntrinsicOperatorKind>(node.payload)
+                        );
+
+                    if (!irOperatorKindResult.has_value()) {
+                        throw std::runtime_error("Unknown intrinsic operator kind");
+                    }
+
+                    ionshared::OptPtr<ionir::Value<>> irRightSideValue = std::nullopt;
+
+                    if (node.hasFlag(LinearNodeFlag::HasValue)) {
+                        irRightSideValue = irValues[node.second]->staticCast<ionir::Value<>>();
+                    }
+
+                    irValues[i] = ionir::OperationValue::make(
+                        *irOperatorKindResult,
+                        irValues[node.first]->staticCast<ionir::Value<>>(),
+                        irRightSideValue
+                    );
 
                     break;
                 }
 
-                case TypeQualifier::Mutable: {
-                    irTypeQualifier = ionir::TypeQualifier::Mutable;
+                case LinearNodeKind::Call: {
+                    const std::shared_ptr<Construct>& callee = linearBody.externals[node.first];
+
+                    // The callee must be either a function or an extern.
+                    if (callee->constructKind != ConstructKind::Function
+                        && callee->constructKind != ConstructKind::Extern) {
+                        // TODO: Use DiagnosticBuilder.
+                        throw std::runtime_error("Callee '%s' is neither a function nor an extern");
+                    }
+
+                    std::vector<std::shared_ptr<ionir::Construct>> irArgs{};
+
+                    irArgs.reserve(node.payload);
+
+                    for (uint32_t j = 0; j < node.payload; j++) {
+                        irArgs.push_back(irValues[linearBody.operandLists[node.second + j]]);
+                    }
+
+                    irValues[i] = irInstBuilder->createCall(
+                        this->safeEarlyVisitOrLookup(callee),
+                        irArgs
+                    );
+
+                    break;
+                }
+
+                case LinearNodeKind::VariableDecl: {
+                    const std::shared_ptr<VariableDeclStmt>& variableDecl =
+                        linearBody.variableDecls[variableDeclIndex++];
+
+                    // Locals never assigned to are bound to their value directly, if it is safe to.
+                    if (!this->requiresStackSlot(variableDecl.get())
+                        && isPromotableValue(irValues[node.first])) {
+                        irValues[i] = irValues[node.first];
+                        this->symbolTable.set(*variableDecl, irValues[i]);
+
+                        break;
+                    }
+
+                    std::shared_ptr<ionir::AllocaInst> irAllocaInst =
+                        irInstBuilder->createAlloca(
+                            *linearBody.names[node.second],
+                            this->safeEarlyVisitOrLookup<ionir::Type>(linearBody.types[node.third])
+                        );
+
+                    irInstBuilder->createStore(
+                        irValues[node.first]->staticCast<ionir::Value<>>(),
+                        irAllocaInst
+                    );
+
+                    /**
+                     * Register the declaration, as it may be referenced by
+                     * constructs lowered through the construct tree.
+                     */
+                    this->symbolTable.set(*variableDecl, irAllocaInst);
+
+                    irValues[i] = irAllocaInst;
+
+                    break;
+                }
+
+                case LinearNodeKind::Assignment: {
+                    std::shared_ptr<ionir::AllocaInst> irAllocaInst =
+                        node.hasFlag(LinearNodeFlag::External)
+                            ? this->safeEarlyVisitOrLookup<ionir::AllocaInst>(linearBody.externals[node.second])
+                            : irValues[node.second]->staticCast<ionir::AllocaInst>();
+
+                    irValues[i] = irInstBuilder->createStore(
+                        irValues[node.first]->staticCast<ionir::Value<>>(),
+                        irAllocaInst
+                    );
+
+                    break;
+                }
+
+                case LinearNodeKind::Return: {
+                    ionshared::OptPtr<ionir::Value<>> irValue = std::nullopt;
+
+                    if (node.hasFlag(LinearNodeFlag::HasValue)) {
+                        irValue = irValues[node.first]->staticCast<ionir::Value<>>();
+                    }
+
+                    irValues[i] = irInstBuilder->createReturn(irValue);
+
+                    break;
+                }
+
+                case LinearNodeKind::ExprWrapper: {
+                    irValues[i] = irValues[node.first];
 
                     break;
                 }
 
                 default: {
-                    throw std::runtime_error("Unknown type qualifier");
+                    throw std::runtime_error("Unknown linear node kind");
                 }
             }
+        }
 
-            irTypeQualifiers->add(irTypeQualifier);
+        // Nodes lowered from a linearized body are accounted on the block.
+        MemoryTracker::recordCreation(
+            MemorySubject::IonIrNode,
+            static_cast<uint32_t>(ConstructKind::Block),
+            linearBody.nodes.size(),
+            0
+        );
+    }
+
+    std::shared_ptr<ionir::Type> IonIrLoweringPass::lowerTypeQualifiers(
+        std::shared_ptr<ionir::Type> type,
+        TypeQualifiers qualifiers
+    ) {
+        // TODO: IonIR has no notion of nested pointers.
+        if (qualifiers.getPointerDepth() > 1) {
+            throw std::runtime_error("Nested pointer types cannot be lowered to IonIR");
         }
 
-        type->qualifiers = irTypeQualifiers;
+        std::shared_ptr<ionir::TypeQualifiers>& irTypeQualifiers =
+            this->irTypeCache->qualifierSets[qualifiers.getFlags()];
 
-        return type;
-    }
+        if (irTypeQualifiers == nullptr) {
+            std::shared_ptr<ionir::TypeQualifiers> newIrTypeQualifiers =
+                std::make_shared<ionir::TypeQualifiers>();
 
-    void IonIrLoweringPass::stashBuffers(const std::function<void()>& callback) {
-        IonIrBuffers buffersBackup = this->irBuffers;
+            for (size_t i = 0; i < IonIrLoweringPass::irTypeQualifierMap.size(); i++) {
+                if ((qualifiers.getFlags() & (1 << i)) == 0) {
+                    continue;
+                }
+                else if (!IonIrLoweringPass::irTypeQualifierMap[i].has_value()) {
+                    throw std::runtime_error("Unknown type qualifier");
+                }
 
-        callback();
-        this->irBuffers = buffersBackup;
-    }
+                newIrTypeQualifiers->add(*IonIrLoweringPass::irTypeQualifierMap[i]);
+            }
 
-    uint32_t IonIrLoweringPass::getNameCounter() noexcept {
-        return this->nameCounter++;
+            irTypeQualifiers = newIrTypeQualifiers;
+        }
+
+        type->qualifiers = irTypeQualifiers;
+
+        return type;
     }
 
     IonIrLoweringPass::IonIrLoweringPass(
         std::shared_ptr<ionshared::PassContext> context,
-        ionshared::PtrSymbolTable<ionir::Module> modules
+        ionshared::PtrSymbolTable<ionir::Module> modules,
+        LoweringOptions options
     ) :
         Pass(std::move(context)),
         modules(std::move(modules)),
         irBuffers(),
         symbolTable(),
-        nameCounter(0) {
+        nameCounter(0),
+        options(std::move(options)),
+        assignedVariableDecls(std::nullopt),
+        irTypeCache(std::make_shared<IonIrTypeCache>()) {
         //
     }
 
@@ -102,88 +560,111 @@ namespace ionlang {
 
     void IonIrLoweringPass::visit(std::shared_ptr<Construct> construct) {
         // Prevent construct from being emitted more than once.
-        if (this->symbolTable.contains(construct)) {
-            return;
-        }
-        // TODO: Hotfix for circular dependency within template. This else if branch should be removed once addressed.
-        else if (construct->constructKind == ConstructKind::Resolvable) {
-            this->visitResolvable(construct->staticCast<Resolvable<>>());
-
+        if (this->symbolTable.contains(*construct)) {
             return;
         }
 
         /**
-         * Only instruct the construct to visit this instance and
+         * Only dispatch to the visit method of this instance and
          * not its children, since they're already visited by
          * the other member methods.
          */
-        construct->accept(*this);
+        dispatchConstruct(*this, construct);
+
+        // IonIR node sizes are unknown to this pass, so only their amount is accounted.
+        if constexpr (MemoryTracker::isEnabled) {
+            if (this->symbolTable.contains(*construct)) {
+                MemoryTracker::recordCreation(
+                    MemorySubject::IonIrNode,
+                    static_cast<uint32_t>(construct->constructKind),
+                    1,
+                    0
+                );
+            }
+        }
     }
 
     void IonIrLoweringPass::visitModule(std::shared_ptr<Module> construct) {
+        PhaseTimer timer{"IonIR lowering"};
+        TraceSpan span{"IonIrLoweringPass::visitModule"};
+
+        if (span.isRecording()) {
+            span.setDetail(construct->name);
+        }
+
+        timer.setUnits("constructs", construct->context->globalScope.getSize());
+
         std::shared_ptr<ionir::Module> irModuleBuffer = std::make_shared<ionir::Module>(
             std::make_shared<ionir::Identifier>(construct->name)
         );
 
         this->irBuffers.modules.push(irModuleBuffer);
 
+        this->irBuffers.globalScopes.push(
+            std::make_shared<ConcurrentScopeTable<ionir::Construct>>()
+        );
+
         // Set the module on the modules symbol table.
         this->modules->set(construct->name, irModuleBuffer);
 
-        // Proceed to visit all the module's children (top-level constructs).
-        std::map<std::string, std::shared_ptr<Construct>> moduleNativeSymbolTable =
-            construct->context->globalScope->unwrap();
+        std::vector<std::shared_ptr<Construct>> topLevelConstructs{};
+        std::vector<std::shared_ptr<Function>> functions{};
 
-        for (const auto& [id, topLevelConstruct] : moduleNativeSymbolTable) {
-            this->visit(topLevelConstruct);
-        }
-
-        this->irBuffers.modules.forcePop();
-    }
+        /**
+         * Proceed to visit all the module's children (top-level constructs)
+         * in the order they were declared. Functions are only declared at
+         * first, so that their bodies may refer to any top-level construct
+         * and be lowered independently of each other. This also keeps the
+         * order of the module's entities independent of the call graph.
+         */
+        for (const auto& [id, topLevelConstruct] : construct->context->globalScope.getEntries()) {
+            if (topLevelConstruct->constructKind == ConstructKind::Function) {
+                std::shared_ptr<Function> function = topLevelConstruct->staticCast<Function>();
 
-    void IonIrLoweringPass::visitFunction(std::shared_ptr<Function> construct) {
-        std::shared_ptr<ionir::Module> irModuleBuffer =
-            this->irBuffers.modules.forceGetTopItem();
+                this->declareFunction(function);
+                functions.push_back(function);
+            }
+            else {
+                this->visit(topLevelConstruct);
+            }
 
-        if (irModuleBuffer->context->getGlobalScope()->contains(construct->prototype->name)) {
-            this->context->diagnosticBuilder
-                ->bootstrap(diagnostic::functionRedefinition)
-                ->formatMessage(construct->prototype->name)
-                ->finish();
+            topLevelConstructs.push_back(topLevelConstruct);
+        }
 
-            // TODO
-            throw std::runtime_error("Awaiting diagnostics implementation during lowering");
+        if (this->options.functionSink.has_value()) {
+            for (const auto& function : functions) {
+                this->streamFunctionBody(function);
+            }
+        }
+        else if (ionshared::util::hasValue(this->options.workStealingPool)
+            && this->options.workStealingPool->get()->getWorkerCount() > 1) {
+            this->lowerFunctionBodiesInParallel(topLevelConstructs, functions);
+        }
+        else {
+            for (const auto& function : functions) {
+                this->lowerFunctionBody(function);
+            }
         }
 
-        std::shared_ptr<ionir::Prototype> irPrototype =
-            this->safeEarlyVisitOrLookup<ionir::Prototype>(construct->prototype);
+        this->irBuffers.globalScopes.forcePop();
+        this->irBuffers.modules.forcePop();
 
-        // TODO: Consider using safeVisitOrLookup() to fill in the body after its visited, instead of doing so from the visitBasicBlock() or visitFunctionBody() methods.
-        /**
-         * The function's body will be filled when visiting the body. The
-         * visit body function will detect that the block being visited is
-         * a function body, and will set the buffered function (this function)'s
-         * body with the newly created one.
-         */
-        std::shared_ptr<ionir::Function> irFunction = ionir::Function::make(
-            irPrototype,
-            std::vector<std::shared_ptr<ionir::BasicBlock>>{}
-        );
+        // Entries are of no use once the module was lowered.
+        this->symbolTable.clear();
+        this->irTypeCache->types.clear();
+    }
 
-        irFunction->setParent(irModuleBuffer);
-        this->irBuffers.functions.push(irFunction);
-        this->visit(construct->body);
-        this->irBuffers.functions.forcePop();
-        irModuleBuffer->insertFunction(irFunction);
-        this->symbolTable.set(construct, irFunction);
+    void IonIrLoweringPass::visitFunction(std::shared_ptr<Function> construct) {
+        this->declareFunction(construct);
+        this->lowerFunctionBody(construct);
     }
 
     void IonIrLoweringPass::visitExtern(std::shared_ptr<Extern> construct) {
         std::shared_ptr<ionir::Module> irModuleBuffer =
             this->irBuffers.modules.forceGetTopItem();
 
-        ionshared::PtrSymbolTable<ionir::Construct> moduleBufferSymbolTable =
-            irModuleBuffer->context->getGlobalScope();
+        std::shared_ptr<ConcurrentScopeTable<ionir::Construct>> irGlobalScope =
+            this->irBuffers.globalScopes.forceGetTopItem();
 
         std::shared_ptr<Prototype> prototype = construct->prototype;
 
@@ -191,7 +672,7 @@ namespace ionlang {
         if (prototype == nullptr) {
             throw std::runtime_error("Unexpected external definition's prototype to be null");
         }
-        else if (moduleBufferSymbolTable->contains(prototype->name)) {
+        else if (irGlobalScope->contains(prototype->name)) {
             throw std::runtime_error("Entity with same id already exists on module");
         }
 
@@ -203,13 +684,17 @@ namespace ionlang {
 
         irExtern->setParent(irModuleBuffer);
 
+        if (!irGlobalScope->set(prototype->name, irExtern)) {
+            throw std::runtime_error("Entity with same id already exists on module");
+        }
+
         /**
          * Register the IonIR extern on the module buffer's symbol table.
          * This will allow the IonIR codegen pass to visit the extern.
          */
-        moduleBufferSymbolTable->set(prototype->name, irExtern);
+        irModuleBuffer->context->getGlobalScope()->set(prototype->name, irExtern);
 
-        this->symbolTable.set(construct, irExtern);
+        this->symbolTable.set(*construct, irExtern);
     }
 
     void IonIrLoweringPass::visitPrototype(std::shared_ptr<Prototype> construct) {
@@ -220,10 +705,8 @@ namespace ionlang {
 
         irArguments->isVariable = construct->argumentList->isVariable;
 
-        auto argumentListNativeMap = construct->argumentList->symbolTable->unwrap();
-
         // TODO: Should Args be a construct, and be visited?
-        for (const auto& [name, constructValue] : argumentListNativeMap) {
+        for (const auto& [name, constructValue] : construct->argumentList->symbolTable) {
             if (constructValue->constructKind != ConstructKind::Resolvable) {
                 continue;
             }
@@ -236,11 +719,11 @@ namespace ionlang {
                 constructValue->dynamicCast<Resolvable<Type>>();
 
             irArguments->items->set(
-                name,
+                *name,
 
                 std::make_pair(
                     this->safeEarlyVisitOrLookup<ionir::Type>(**typeResolvable),
-                    name
+                    *name
                 )
             );
         }
@@ -253,7 +736,7 @@ namespace ionlang {
             );
 
         irPrototype->setParent(this->irBuffers.modules.forceGetTopItem());
-        this->symbolTable.set(construct, irPrototype);
+        this->symbolTable.set(*construct, irPrototype);
     }
 
     void IonIrLoweringPass::visitBlock(std::shared_ptr<Block> construct) {
@@ -268,15 +751,24 @@ namespace ionlang {
         irBasicBlock->setParent(irFunctionBuffer);
         this->irBuffers.basicBlocks.push(irBasicBlock);
 
-        std::vector<std::shared_ptr<Statement>> statements = construct->statements;
+        std::optional<LinearBody> linearBody = this->options.useLinearBodies
+            ? LinearBody::fromBlock(construct)
+            : std::nullopt;
+
+        if (linearBody.has_value()) {
+            this->lowerLinearBody(*linearBody);
+        }
+        else {
+            std::vector<std::shared_ptr<Statement>> statements = construct->statements;
 
-        for (const auto& statement : statements) {
-            this->visit(statement);
+            for (const auto& statement : statements) {
+                this->visit(statement);
+            }
         }
 
         this->irBuffers.basicBlocks.forcePop();
         irFunctionBuffer->basicBlocks.push_back(irBasicBlock);
-        this->symbolTable.set(construct, irBasicBlock);
+        this->symbolTable.set(*construct, irBasicBlock);
     }
 
     void IonIrLoweringPass::visitIntegerLiteral(std::shared_ptr<IntegerLiteral> construct) {
@@ -295,7 +787,7 @@ namespace ionlang {
         std::shared_ptr<ionir::IntegerType> irIntegerType =
             this->safeEarlyVisitOrLookup<ionir::IntegerType>(integerType);
 
-        this->symbolTable.set(construct, ionir::IntegerLiteral::make(
+        this->symbolTable.set(*construct, ionir::IntegerLiteral::make(
             irIntegerType,
             construct->value
         ));
@@ -303,21 +795,21 @@ namespace ionlang {
 
     void IonIrLoweringPass::visitCharLiteral(std::shared_ptr<CharLiteral> construct) {
         this->symbolTable.set(
-            construct,
+            *construct,
             std::make_shared<ionir::CharLiteral>(construct->value)
         );
     }
 
     void IonIrLoweringPass::visitStringLiteral(std::shared_ptr<StringLiteral> construct) {
         this->symbolTable.set(
-            construct,
+            *construct,
             std::make_shared<ionir::StringLiteral>(construct->value)
         );
     }
 
     void IonIrLoweringPass::visitBooleanLiteral(std::shared_ptr<BooleanLiteral> construct) {
         this->symbolTable.set(
-            construct,
+            *construct,
             std::make_shared<ionir::BooleanLiteral>(construct->value)
         );
     }
@@ -328,8 +820,30 @@ namespace ionlang {
 
         ionshared::OptPtr<ionir::Value<>> irValue = std::nullopt;
 
+        /**
+         * Constant globals are lowered with the constant qualifier on
+         * their type, and must be initialized.
+         */
+        if (construct->type->forceGetValue()->qualifiers.has(TypeQualifier::Constant)
+            && !ionshared::util::hasValue(construct->value)) {
+            // TODO: Use DiagnosticBuilder.
+            throw std::runtime_error("Constant global '" + construct->name + "' must be initialized");
+        }
+
         // Assign value if applicable.
         if (ionshared::util::hasValue(construct->value)) {
+            /**
+             * There is no code running before the entry point, so the
+             * initializer must have been folded into static data by
+             * the constant folding pass.
+             */
+            if (!constant_evaluation::isStaticInitializer(*construct->value)) {
+                // TODO: Use DiagnosticBuilder.
+                throw std::runtime_error(
+                    "Initializer of global '" + construct->name + "' is not a compile-time constant"
+                );
+            }
+
             // NOTE: Use static pointer cast when downcasting to ionir::Value<>.
             irValue = this->safeEarlyVisitOrLookup<ionir::Value<>>(
                 *construct->value,
@@ -340,7 +854,10 @@ namespace ionlang {
         std::shared_ptr<ionir::Global> irGlobal =
             ionir::Global::make(irType, construct->name, irValue);
 
-        // TODO: Check if exists first?
+        if (!this->irBuffers.globalScopes.forceGetTopItem()->set(irGlobal->name, irGlobal)) {
+            // TODO: Use DiagnosticBuilder.
+            throw std::runtime_error("Entity with same id already exists on module");
+        }
 
         /**
          * Register the global variable on the buffered module's symbol table.
@@ -352,7 +869,7 @@ namespace ionlang {
             irGlobal
         );
 
-        this->symbolTable.set(construct, irGlobal);
+        this->symbolTable.set(*construct, irGlobal);
     }
 
     void IonIrLoweringPass::visitIntegerType(std::shared_ptr<IntegerType> construct) {
@@ -398,24 +915,40 @@ namespace ionlang {
             }
         }
 
-        this->symbolTable.set(construct, IonIrLoweringPass::processTypeQualifiers(
-            std::make_shared<ionir::IntegerType>(irIntegerKind, construct->isSigned),
+        uint32_t typeKey = makeTypeKey(
+            TypeKind::Integer,
+            static_cast<uint32_t>(construct->integerKind) << 1 | construct->isSigned,
             construct->qualifiers
-        ));
+        );
+
+        this->symbolTable.set(*construct, this->findOrCreateIrType(typeKey, [&] {
+            return this->lowerTypeQualifiers(
+                std::make_shared<ionir::IntegerType>(irIntegerKind, construct->isSigned),
+                construct->qualifiers
+            );
+        }));
     }
 
     void IonIrLoweringPass::visitBooleanType(std::shared_ptr<BooleanType> construct) {
-        this->symbolTable.set(construct, IonIrLoweringPass::processTypeQualifiers(
-            std::make_shared<ionir::BooleanType>(),
-            construct->qualifiers
-        ));
+        uint32_t typeKey = makeTypeKey(TypeKind::Boolean, 0, construct->qualifiers);
+
+        this->symbolTable.set(*construct, this->findOrCreateIrType(typeKey, [&] {
+            return this->lowerTypeQualifiers(
+                std::make_shared<ionir::BooleanType>(),
+                construct->qualifiers
+            );
+        }));
     }
 
     void IonIrLoweringPass::visitVoidType(std::shared_ptr<VoidType> construct) {
-        this->symbolTable.set(construct, IonIrLoweringPass::processTypeQualifiers(
-            std::make_shared<ionir::VoidType>(),
-            construct->qualifiers
-        ));
+        uint32_t typeKey = makeTypeKey(TypeKind::Void, 0, construct->qualifiers);
+
+        this->symbolTable.set(*construct, this->findOrCreateIrType(typeKey, [&] {
+            return this->lowerTypeQualifiers(
+                std::make_shared<ionir::VoidType>(),
+                construct->qualifiers
+            );
+        }));
     }
 
     void IonIrLoweringPass::visitStructType(std::shared_ptr<StructType> construct) {
@@ -424,22 +957,21 @@ namespace ionlang {
         std::shared_ptr<ionir::Module> irModuleBuffer =
             this->irBuffers.modules.forceGetTopItem();
 
-        ionir::Scope globalSymbolTable = irModuleBuffer->context->getGlobalScope();
+        std::shared_ptr<ConcurrentScopeTable<ionir::Construct>> irGlobalScope =
+            this->irBuffers.globalScopes.forceGetTopItem();
 
         // TODO: Check local symbol table too?
-        if (globalSymbolTable->contains(construct->typeName)) {
+        if (irGlobalScope->contains(construct->typeName)) {
             // TODO: Use DiagnosticBuilder.
             throw std::runtime_error("Struct was already previously defined in the module");
         }
 
-        auto fieldsNativeMap = construct->fields->unwrap();
-
         ionir::Fields irFields =
             ionshared::util::makePtrSymbolTable<ionir::Type>();
 
-        for (const auto& [name, irType] : fieldsNativeMap) {
+        for (const auto& [name, irType] : construct->fields) {
             irFields->set(
-                name,
+                *name,
                 this->safeEarlyVisitOrLookup<ionir::Type>(irType)
             );
         }
@@ -449,12 +981,17 @@ namespace ionlang {
 
         irStruct->setParent(this->irBuffers.modules.forceGetTopItem());
 
+        if (!irGlobalScope->set(construct->typeName, irStruct)) {
+            // TODO: Use DiagnosticBuilder.
+            throw std::runtime_error("Struct was already previously defined in the module");
+        }
+
         irModuleBuffer->context->getGlobalScope()->set(
             construct->typeName,
             irStruct
         );
 
-        this->symbolTable.set(construct, irStruct);
+        this->symbolTable.set(*construct, irStruct);
     }
 
     void IonIrLoweringPass::visitIfStmt(std::shared_ptr<IfStmt> construct) {
@@ -549,7 +1086,7 @@ namespace ionlang {
         }
 
         this->symbolTable.set(
-            construct,
+            *construct,
             this->irBuffers.makeBuilder()->createReturn(irValue)
         );
     }
@@ -566,7 +1103,7 @@ namespace ionlang {
             );
 
         this->symbolTable.set(
-            construct,
+            *construct,
 
             this->irBuffers.makeBuilder()->createStore(
                 this->safeEarlyVisitOrLookup<ionir::Value<>>(construct->value, false),
@@ -576,6 +1113,20 @@ namespace ionlang {
     }
 
     void IonIrLoweringPass::visitVariableDeclStmt(std::shared_ptr<VariableDeclStmt> construct) {
+        // Locals never assigned to are bound to their value directly, as an SSA value.
+        if (!this->requiresStackSlot(construct.get())) {
+            std::shared_ptr<ionir::Value<>> irValue =
+                this->safeEarlyVisitOrLookup<ionir::Value<>>(construct->value, false);
+
+            if (isPromotableValue(irValue)) {
+                this->symbolTable.set(*construct, irValue);
+
+                return;
+            }
+
+            // Otherwise, the local keeps its stack slot, and the value is only looked up below.
+        }
+
         std::shared_ptr<ionir::InstBuilder> irInstBuilder =
             this->irBuffers.makeBuilder();
 
@@ -585,7 +1136,7 @@ namespace ionlang {
         std::shared_ptr<ionir::AllocaInst> irAllocaInst =
             irInstBuilder->createAlloca(construct->name, irType);
 
-        this->symbolTable.set(construct, irAllocaInst);
+        this->symbolTable.set(*construct, irAllocaInst);
 
         // TODO: Value can be an expression as well. Check that ConstructKind == Value, otherwise handle appropriately.
         std::shared_ptr<ionir::Value<>> irValue =
@@ -600,7 +1151,7 @@ namespace ionlang {
 
     void IonIrLoweringPass::visitExprWrapperStmt(std::shared_ptr<ExprWrapperStmt> construct) {
         this->symbolTable.set(
-            construct,
+            *construct,
             this->safeEarlyVisitOrLookup(construct->expression)
         );
     }
@@ -636,7 +1187,7 @@ namespace ionlang {
          * set because the builder buffer is set.
          */
         this->symbolTable.set(
-            construct,
+            *construct,
 
             this->irBuffers.makeBuilder()->createCall(
                 irCallee,
@@ -663,7 +1214,7 @@ namespace ionlang {
                 this->safeEarlyVisitOrLookup<ionir::Value<>>(*construct->rightSideValue, false);
         }
 
-        this->symbolTable.set(construct, ionir::OperationValue::make(
+        this->symbolTable.set(*construct, ionir::OperationValue::make(
             *irOperatorKindResult,
             irLeftSideValue,
             irRightSideValue
@@ -672,10 +1223,12 @@ namespace ionlang {
 
     void IonIrLoweringPass::visitVariableRefExpr(std::shared_ptr<VariableRefExpr> construct) {
         this->symbolTable.set(
-            construct,
+            *construct,
 
-            this->safeEarlyVisitOrLookup<ionir::AllocaInst>(
-                **construct->variableDecl
+            // Either the local's stack slot, or its value if it was promoted.
+            this->safeEarlyVisitOrLookup<ionir::Value<>>(
+                **construct->variableDecl,
+                false
             )
         );
     }
@@ -698,7 +1251,7 @@ namespace ionlang {
             );
         }
 
-        this->symbolTable.set(construct, ionir::StructDefinition::make(
+        this->symbolTable.set(*construct, ionir::StructDefinition::make(
             irStructType,
             irValues
         ));
@@ -711,7 +1264,7 @@ namespace ionlang {
         }
 
         this->symbolTable.set(
-            construct,
+            *construct,
             this->safeEarlyVisitOrLookup(*construct->getValue())
         );
     }
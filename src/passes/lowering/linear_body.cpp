@@ -0,0 +1,321 @@
+#include <limits>
+#include <ionlang/passes/lowering/linear_body.h>
+#include <ionlang/passes/pass.h>
+
+namespace ionlang {
+    bool LinearNode::hasFlag(LinearNodeFlag flag) const noexcept {
+        return (this->flags & static_cast<uint8_t>(flag)) != 0;
+    }
+
+    std::optional<LinearBody> LinearBody::fromBlock(const std::shared_ptr<Block>& block) {
+        LinearBody linearBody{};
+        BuildState state{block.get(), {}};
+
+        for (const auto& statement : block->statements) {
+            if (!linearBody.appendStatement(statement, state).has_value()) {
+                return std::nullopt;
+            }
+        }
+
+        return linearBody;
+    }
+
+    std::optional<uint32_t> LinearBody::appendNode(LinearNode node) {
+        if (this->nodes.size() >= std::numeric_limits<uint32_t>::max()) {
+            return std::nullopt;
+        }
+
+        this->nodes.push_back(node);
+
+        return static_cast<uint32_t>(this->nodes.size() - 1);
+    }
+
+    std::optional<uint32_t> LinearBody::appendStatement(
+        const std::shared_ptr<Statement>& statement,
+        BuildState& state
+    ) {
+        LinearNode node{};
+
+        switch (statement->statementKind) {
+            case StatementKind::VariableDeclaration: {
+                std::shared_ptr<VariableDeclStmt> variableDecl =
+                    statement->staticCast<VariableDeclStmt>();
+
+                if (!variableDecl->type->isResolved()) {
+                    return std::nullopt;
+                }
+
+                std::optional<uint32_t> valueIndex =
+                    this->appendExpression(variableDecl->value, state);
+
+                if (!valueIndex.has_value()) {
+                    return std::nullopt;
+                }
+
+                node.kind = LinearNodeKind::VariableDecl;
+                node.first = *valueIndex;
+                node.second = static_cast<uint32_t>(this->names.size());
+                node.third = static_cast<uint32_t>(this->types.size());
+                this->names.push_back(NameInterner::getGlobal().intern(variableDecl->name));
+                this->types.push_back(variableDecl->type->forceGetValue());
+                this->variableDecls.push_back(variableDecl);
+
+                std::optional<uint32_t> nodeIndex = this->appendNode(node);
+
+                if (nodeIndex.has_value()) {
+                    state.declIndices[variableDecl.get()] = *nodeIndex;
+                }
+
+                return nodeIndex;
+            }
+
+            case StatementKind::Assignment: {
+                std::shared_ptr<AssignmentStmt> assignment =
+                    statement->staticCast<AssignmentStmt>();
+
+                if (!assignment->variableDeclStmtRef->isResolved()) {
+                    return std::nullopt;
+                }
+
+                std::optional<uint32_t> valueIndex =
+                    this->appendExpression(assignment->value, state);
+
+                if (!valueIndex.has_value()) {
+                    return std::nullopt;
+                }
+
+                std::optional<uint32_t> variableIndex = this->appendVariableOperand(
+                    node,
+                    assignment->variableDeclStmtRef->forceGetValue(),
+                    state
+                );
+
+                if (!variableIndex.has_value()) {
+                    return std::nullopt;
+                }
+
+                node.kind = LinearNodeKind::Assignment;
+                node.first = *valueIndex;
+                node.second = *variableIndex;
+
+                return this->appendNode(node);
+            }
+
+            case StatementKind::Return: {
+                std::shared_ptr<ReturnStmt> returnStmt =
+                    statement->staticCast<ReturnStmt>();
+
+                node.kind = LinearNodeKind::Return;
+
+                if (returnStmt->hasValue()) {
+                    std::optional<uint32_t> valueIndex =
+                        this->appendExpression(*returnStmt->value, state);
+
+                    if (!valueIndex.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    node.flags |= static_cast<uint8_t>(LinearNodeFlag::HasValue);
+                    node.first = *valueIndex;
+                }
+
+                return this->appendNode(node);
+            }
+
+            case StatementKind::ExprWrapper: {
+                std::optional<uint32_t> expressionIndex = this->appendExpression(
+                    statement->staticCast<ExprWrapperStmt>()->expression,
+                    state
+                );
+
+                if (!expressionIndex.has_value()) {
+                    return std::nullopt;
+                }
+
+                node.kind = LinearNodeKind::ExprWrapper;
+                node.first = *expressionIndex;
+
+                return this->appendNode(node);
+            }
+
+            // Nested blocks cannot be represented.
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    std::optional<uint32_t> LinearBody::appendExpression(
+        const std::shared_ptr<Expression<>>& expression,
+        const BuildState& state
+    ) {
+        LinearNode node{};
+
+        switch (expression->expressionKind) {
+            case ExpressionKind::IntegerLiteral: {
+                std::shared_ptr<IntegerLiteral> integerLiteral =
+                    expression->staticCast<IntegerLiteral>();
+
+                if (!integerLiteral->type->isResolved()) {
+                    return std::nullopt;
+                }
+
+                node.kind = LinearNodeKind::IntegerLiteral;
+                node.first = static_cast<uint32_t>(this->integers.size());
+                node.second = static_cast<uint32_t>(this->types.size());
+                this->integers.push_back(integerLiteral->value);
+                this->types.push_back(integerLiteral->type->forceGetValue());
+
+                break;
+            }
+
+            case ExpressionKind::BooleanLiteral: {
+                node.kind = LinearNodeKind::BooleanLiteral;
+                node.payload = expression->staticCast<BooleanLiteral>()->value ? 1 : 0;
+
+                break;
+            }
+
+            case ExpressionKind::CharLiteral: {
+                node.kind = LinearNodeKind::CharLiteral;
+
+                node.payload = static_cast<unsigned char>(
+                    expression->staticCast<CharLiteral>()->value
+                );
+
+                break;
+            }
+
+            case ExpressionKind::StringLiteral: {
+                node.kind = LinearNodeKind::StringLiteral;
+                node.first = static_cast<uint32_t>(this->strings.size());
+                this->strings.push_back(expression->staticCast<StringLiteral>()->value);
+
+                break;
+            }
+
+            case ExpressionKind::VariableReference: {
+                std::shared_ptr<VariableRefExpr> variableRef =
+                    expression->staticCast<VariableRefExpr>();
+
+                if (!variableRef->variableDecl->isResolved()) {
+                    return std::nullopt;
+                }
+
+                std::optional<uint32_t> variableIndex = this->appendVariableOperand(
+                    node,
+                    variableRef->variableDecl->forceGetValue(),
+                    state
+                );
+
+                if (!variableIndex.has_value()) {
+                    return std::nullopt;
+                }
+
+                node.kind = LinearNodeKind::VariableRef;
+                node.first = *variableIndex;
+
+                break;
+            }
+
+            case ExpressionKind::Operation: {
+                std::shared_ptr<OperationExpr> operation =
+                    expression->staticCast<OperationExpr>();
+
+                std::optional<uint32_t> leftSideIndex =
+                    this->appendExpression(operation->leftSideValue, state);
+
+                if (!leftSideIndex.has_value()) {
+                    return std::nullopt;
+                }
+
+                node.kind = LinearNodeKind::Operation;
+                node.payload = static_cast<uint16_t>(operation->operation);
+                node.first = *leftSideIndex;
+
+                if (ionshared::util::hasValue(operation->rightSideValue)) {
+                    std::optional<uint32_t> rightSideIndex =
+                        this->appendExpression(*operation->rightSideValue, state);
+
+                    if (!rightSideIndex.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    node.flags |= static_cast<uint8_t>(LinearNodeFlag::HasValue);
+                    node.second = *rightSideIndex;
+                }
+
+                break;
+            }
+
+            case ExpressionKind::Call: {
+                std::shared_ptr<CallExpr> call = expression->staticCast<CallExpr>();
+
+                if (!call->calleeResolvable->isResolved()
+                    || call->arguments.size() > std::numeric_limits<uint16_t>::max()) {
+                    return std::nullopt;
+                }
+
+                std::vector<uint32_t> argumentIndices{};
+
+                argumentIndices.reserve(call->arguments.size());
+
+                for (const auto& argument : call->arguments) {
+                    std::optional<uint32_t> argumentIndex =
+                        this->appendExpression(argument, state);
+
+                    if (!argumentIndex.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    argumentIndices.push_back(*argumentIndex);
+                }
+
+                node.kind = LinearNodeKind::Call;
+                node.payload = static_cast<uint16_t>(argumentIndices.size());
+                node.first = static_cast<uint32_t>(this->externals.size());
+                node.second = static_cast<uint32_t>(this->operandLists.size());
+                this->externals.push_back(call->calleeResolvable->forceGetValue());
+
+                this->operandLists.insert(
+                    this->operandLists.end(),
+                    argumentIndices.begin(),
+                    argumentIndices.end()
+                );
+
+                break;
+            }
+
+            // Struct definitions and casts are not supported.
+            default: {
+                return std::nullopt;
+            }
+        }
+
+        return this->appendNode(node);
+    }
+
+    std::optional<uint32_t> LinearBody::appendVariableOperand(
+        LinearNode& node,
+        const std::shared_ptr<VariableDeclStmt>& variableDecl,
+        const BuildState& state
+    ) {
+        if (auto localDecl = state.declIndices.find(variableDecl.get());
+            localDecl != state.declIndices.end()) {
+            return localDecl->second;
+        }
+        /**
+         * The declaration belongs to the body, but appears later on (or is
+         * being declared). Leave it to the construct tree to handle.
+         */
+        else if (variableDecl->getParent().has_value()
+            && variableDecl->forceGetParent().get() == state.block) {
+            return std::nullopt;
+        }
+
+        node.flags |= static_cast<uint8_t>(LinearNodeFlag::External);
+        this->externals.push_back(variableDecl);
+
+        return static_cast<uint32_t>(this->externals.size() - 1);
+    }
+}
@@ -0,0 +1,304 @@
+#include <ionlang/passes/optimization/constant_folding_pass.h>
+#include <ionlang/passes/static_pass.h>
+
+namespace ionlang {
+    /**
+     * Collects the names of the variables assigned to within a tree.
+     */
+    struct AssignmentCollector : StaticPass<AssignmentCollector> {
+        std::unordered_set<std::string>& assignedNames;
+
+        explicit AssignmentCollector(std::unordered_set<std::string>& assignedNames) noexcept :
+            assignedNames(assignedNames) {
+            //
+        }
+
+        void visitAssignmentStmt(const std::shared_ptr<AssignmentStmt>& construct) {
+            const PtrResolvable<VariableDeclStmt>& variableDeclRef = construct->variableDeclStmtRef;
+
+            if (variableDeclRef->id.has_value()) {
+                this->assignedNames.insert(***variableDeclRef->id);
+            }
+            else if (variableDeclRef->isResolved()) {
+                this->assignedNames.insert(variableDeclRef->forceGetValue()->name);
+            }
+        }
+    };
+
+    void ConstantFoldingStatistics::writeReport(std::ostream& stream) const {
+        stream << "===-------------------------------------------------------------------------===" << std::endl
+            << "                          Constant folding report" << std::endl
+            << "===-------------------------------------------------------------------------===" << std::endl
+            << "  Folded operations:      " << this->foldedOperationCount << std::endl
+            << "  Propagated references:  " << this->propagatedReferenceCount << std::endl
+            << "  Evaluated calls:        " << this->evaluatedCallCount << std::endl
+            << "  Removed IonIR nodes:    " << this->removedIonIrNodeCount << std::endl;
+    }
+
+    std::shared_ptr<Expression<>> ConstantFoldingPass::foldExpression(
+        const std::shared_ptr<Expression<>>& expression,
+        const std::shared_ptr<Construct>& parent
+    ) {
+        std::optional<Constant> result = std::nullopt;
+
+        switch (expression->expressionKind) {
+            case ExpressionKind::Operation: {
+                std::shared_ptr<OperationExpr> operationExpr =
+                    expression->staticCast<OperationExpr>();
+
+                operationExpr->leftSideValue =
+                    this->foldExpression(operationExpr->leftSideValue, operationExpr);
+
+                std::optional<Constant> leftSide =
+                    constant_evaluation::findConstant(operationExpr->leftSideValue);
+
+                std::optional<Constant> rightSide = std::nullopt;
+
+                if (operationExpr->isBinary()) {
+                    operationExpr->rightSideValue =
+                        this->foldExpression(*operationExpr->rightSideValue, operationExpr);
+
+                    rightSide = constant_evaluation::findConstant(*operationExpr->rightSideValue);
+
+                    if (!rightSide.has_value()) {
+                        return expression;
+                    }
+                }
+
+                if (!leftSide.has_value()) {
+                    return expression;
+                }
+
+                result = constant_evaluation::evaluate(operationExpr->operation, *leftSide, rightSide);
+
+                if (!result.has_value()) {
+                    return expression;
+                }
+
+                this->statistics.foldedOperationCount++;
+                this->statistics.removedIonIrNodeCount += operationExpr->isBinary() ? 2 : 1;
+
+                break;
+            }
+
+            case ExpressionKind::VariableReference: {
+                ionshared::OptPtr<VariableDeclStmt> variableDecl =
+                    expression->staticCast<VariableRefExpr>()->variableDecl->getValue();
+
+                if (!ionshared::util::hasValue(variableDecl)
+                    || this->assignedNames.contains(variableDecl->get()->name)) {
+                    return expression;
+                }
+
+                result = constant_evaluation::findConstant(variableDecl->get()->value);
+
+                ionshared::OptPtr<Type> declaredType = variableDecl->get()->type->getValue();
+
+                if (!result.has_value() || !ionshared::util::hasValue(declaredType)) {
+                    return expression;
+                }
+
+                // The initializer's literal has its own type, rather than the declared one.
+                result = constant_evaluation::convert(*result, *declaredType);
+
+                if (!result.has_value()) {
+                    return expression;
+                }
+
+                this->statistics.propagatedReferenceCount++;
+
+                break;
+            }
+
+            case ExpressionKind::Call: {
+                std::shared_ptr<CallExpr> callExpr = expression->staticCast<CallExpr>();
+
+                ionshared::OptPtr<Construct> callee = callExpr->calleeResolvable->getValue();
+                std::vector<Constant> arguments{};
+                bool areArgumentsConstant = true;
+
+                for (auto& argument : callExpr->arguments) {
+                    argument = this->foldExpression(argument, callExpr);
+
+                    std::optional<Constant> constant = constant_evaluation::findConstant(argument);
+
+                    if (constant.has_value()) {
+                        arguments.push_back(*constant);
+                    }
+                    else {
+                        areArgumentsConstant = false;
+                    }
+                }
+
+                if (!ionshared::util::hasValue(this->interpreter)
+                    || !areArgumentsConstant
+                    || !ionshared::util::hasValue(callee)
+                    || callee->get()->constructKind != ConstructKind::Function) {
+                    return expression;
+                }
+
+                result = this->interpreter->get()->call(
+                    callee->get()->staticCast<Function>(),
+                    arguments
+                );
+
+                if (!result.has_value()) {
+                    return expression;
+                }
+
+                this->statistics.evaluatedCallCount++;
+
+                break;
+            }
+
+            case ExpressionKind::StructDefinition: {
+                std::shared_ptr<StructDefExpr> structDefExpr =
+                    expression->staticCast<StructDefExpr>();
+
+                for (auto& value : structDefExpr->values) {
+                    value = this->foldExpression(value, structDefExpr);
+                }
+
+                return expression;
+            }
+
+            case ExpressionKind::Cast: {
+                std::shared_ptr<CastExpr> castExpr = expression->staticCast<CastExpr>();
+
+                castExpr->value = this->foldExpression(castExpr->value, castExpr);
+
+                return expression;
+            }
+
+            default: {
+                return expression;
+            }
+        }
+
+        std::shared_ptr<Expression<>> literal = constant_evaluation::makeLiteral(*result);
+
+        literal->setParent(parent);
+
+        return literal;
+    }
+
+    void ConstantFoldingPass::foldStatement(const std::shared_ptr<Statement>& statement) {
+        switch (statement->statementKind) {
+            case StatementKind::VariableDeclaration: {
+                std::shared_ptr<VariableDeclStmt> variableDecl =
+                    statement->staticCast<VariableDeclStmt>();
+
+                variableDecl->value = this->foldExpression(variableDecl->value, variableDecl);
+
+                break;
+            }
+
+            case StatementKind::Assignment: {
+                std::shared_ptr<AssignmentStmt> assignmentStmt =
+                    statement->staticCast<AssignmentStmt>();
+
+                assignmentStmt->value = this->foldExpression(assignmentStmt->value, assignmentStmt);
+
+                break;
+            }
+
+            case StatementKind::Return: {
+                std::shared_ptr<ReturnStmt> returnStmt = statement->staticCast<ReturnStmt>();
+
+                if (ionshared::util::hasValue(returnStmt->value)) {
+                    returnStmt->value = this->foldExpression(*returnStmt->value, returnStmt);
+                }
+
+                break;
+            }
+
+            case StatementKind::If: {
+                std::shared_ptr<IfStmt> ifStmt = statement->staticCast<IfStmt>();
+
+                if (ifStmt->condition->constructKind == ConstructKind::Expression) {
+                    ifStmt->condition = this->foldExpression(
+                        ifStmt->condition->staticCast<Expression<>>(),
+                        ifStmt
+                    );
+                }
+
+                break;
+            }
+
+            case StatementKind::ExprWrapper: {
+                std::shared_ptr<ExprWrapperStmt> exprWrapperStmt =
+                    statement->staticCast<ExprWrapperStmt>();
+
+                exprWrapperStmt->expression =
+                    this->foldExpression(exprWrapperStmt->expression, exprWrapperStmt);
+
+                break;
+            }
+
+            default: {
+                break;
+            }
+        }
+    }
+
+    ConstantFoldingPass::ConstantFoldingPass(
+        std::shared_ptr<ionshared::PassContext> context,
+        ionshared::OptPtr<CompileTimeInterpreter> interpreter
+    ) noexcept :
+        Pass(std::move(context)),
+        statistics(),
+        assignedNames(),
+        interpreter(std::move(interpreter)),
+        isVisitingModule(false) {
+        //
+    }
+
+    void ConstantFoldingPass::enterConstruct(const std::shared_ptr<Construct>& construct) {
+        if (construct->constructKind == ConstructKind::Module) {
+            this->isVisitingModule = true;
+        }
+        else if (construct->constructKind == ConstructKind::Function) {
+            /**
+             * Other functions' bodies may be resolved and folded by other
+             * workers while a lone function is being visited.
+             */
+            if (ionshared::util::hasValue(this->interpreter) && !this->isVisitingModule) {
+                // TODO: Use DiagnosticBuilder.
+                throw std::runtime_error("Calls may only be evaluated when folding a whole module");
+            }
+
+            AssignmentCollector assignmentCollector{this->assignedNames};
+
+            this->assignedNames.clear();
+            assignmentCollector.visit(construct);
+        }
+
+        Pass::enterConstruct(construct);
+    }
+
+    void ConstantFoldingPass::leaveConstruct(const std::shared_ptr<Construct>& construct) {
+        if (construct->constructKind == ConstructKind::Module) {
+            this->isVisitingModule = false;
+        }
+        else if (construct->constructKind == ConstructKind::Statement) {
+            this->foldStatement(construct->staticCast<Statement>());
+        }
+        else if (construct->constructKind == ConstructKind::Global) {
+            std::shared_ptr<Global> global = construct->staticCast<Global>();
+
+            if (ionshared::util::hasValue(global->value)) {
+                global->value = this->foldExpression(*global->value, global);
+            }
+        }
+    }
+
+    void ConstantFoldingPass::abortConstruct(const std::shared_ptr<Construct>& construct) {
+        if (construct->constructKind == ConstructKind::Module) {
+            this->isVisitingModule = false;
+        }
+    }
+
+    const ConstantFoldingStatistics& ConstantFoldingPass::getStatistics() const noexcept {
+        return this->statistics;
+    }
+}
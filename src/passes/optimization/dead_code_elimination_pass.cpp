@@ -0,0 +1,236 @@
+#include <ionlang/passes/optimization/dead_code_elimination_pass.h>
+#include <ionlang/passes/static_pass.h>
+
+namespace ionlang {
+    /**
+     * Collects the names of the top-level constructs a tree may refer to.
+     * Unresolved references are collected by name, which may also match
+     * locals shadowing a global, and so can only keep more alive.
+     */
+    struct ReferenceCollector : StaticPass<ReferenceCollector> {
+        std::vector<std::string>& referencedNames;
+
+        explicit ReferenceCollector(std::vector<std::string>& referencedNames) noexcept :
+            referencedNames(referencedNames) {
+            //
+        }
+
+        void visitResolvable(const std::shared_ptr<Resolvable<>>& construct) {
+            if (construct->id.has_value()) {
+                this->referencedNames.push_back(***construct->id);
+            }
+
+            ionshared::OptPtr<Construct> value = construct->getValue();
+
+            if (!ionshared::util::hasValue(value)) {
+                return;
+            }
+
+            switch (value->get()->constructKind) {
+                case ConstructKind::Function: {
+                    this->referencedNames.push_back(
+                        value->get()->staticCast<Function>()->prototype->name
+                    );
+
+                    break;
+                }
+
+                case ConstructKind::Extern: {
+                    this->referencedNames.push_back(
+                        value->get()->staticCast<Extern>()->prototype->name
+                    );
+
+                    break;
+                }
+
+                case ConstructKind::Global: {
+                    this->referencedNames.push_back(value->get()->staticCast<Global>()->name);
+
+                    break;
+                }
+
+                default: {
+                    break;
+                }
+            }
+        }
+    };
+
+    void DeadCodeEliminationStatistics::writeReport(std::ostream& stream) const {
+        stream << "===-------------------------------------------------------------------------===" << std::endl
+            << "                        Dead code elimination report" << std::endl
+            << "===-------------------------------------------------------------------------===" << std::endl
+            << "  Removed statements:     " << this->removedStatementCount << std::endl
+            << "  Removed branches:       " << this->removedBranchCount << std::endl
+            << "  Removed functions:      " << this->removedFunctionCount << std::endl
+            << "  Removed globals:        " << this->removedGlobalCount << std::endl;
+    }
+
+    void DeadCodeEliminationPass::eliminateBranches(const std::shared_ptr<Block>& block) {
+        size_t orderIndex = 0;
+
+        while (orderIndex < block->statements.size()) {
+            const std::shared_ptr<Statement>& statement = block->statements[orderIndex];
+
+            if (statement->statementKind != StatementKind::If) {
+                orderIndex++;
+
+                continue;
+            }
+
+            std::shared_ptr<IfStmt> ifStmt = statement->staticCast<IfStmt>();
+
+            if (ifStmt->condition->constructKind != ConstructKind::Expression
+                || ifStmt->condition->staticCast<Expression<>>()->expressionKind
+                    != ExpressionKind::BooleanLiteral) {
+                orderIndex++;
+
+                continue;
+            }
+
+            ionshared::OptPtr<Block> takenBlock =
+                ifStmt->condition->staticCast<BooleanLiteral>()->value
+                    ? ionshared::OptPtr<Block>(ifStmt->consequentBlock)
+                    : ifStmt->alternativeBlock;
+
+            if (!ionshared::util::hasValue(takenBlock)) {
+                block->eraseStatements(orderIndex, orderIndex + 1);
+                this->statistics.removedStatementCount++;
+                this->statistics.removedBranchCount++;
+
+                continue;
+            }
+
+            /**
+             * The taken block's statements are inlined rather than kept
+             * within their own block, which lowering would not emit. Their
+             * declarations then join the local symbol table, so the branch
+             * is left intact if any of them would collide with a local one.
+             */
+            std::vector<std::shared_ptr<Statement>> takenStatements =
+                takenBlock->get()->statements;
+
+            bool isCollision = false;
+
+            for (const auto& takenStatement : takenStatements) {
+                if (takenStatement->statementKind == StatementKind::VariableDeclaration
+                    && block->symbolTable.contains(
+                        takenStatement->staticCast<VariableDeclStmt>()->name
+                    )) {
+                    isCollision = true;
+
+                    break;
+                }
+            }
+
+            if (isCollision) {
+                orderIndex++;
+
+                continue;
+            }
+
+            block->eraseStatements(orderIndex, orderIndex + 1);
+            block->insertStatements(orderIndex, takenStatements);
+            this->statistics.removedBranchCount++;
+            orderIndex += takenStatements.size();
+        }
+    }
+
+    void DeadCodeEliminationPass::eliminateUnreachableStatements(
+        const std::shared_ptr<Block>& block
+    ) {
+        std::vector<std::shared_ptr<Statement>> terminals = block->findTerminals();
+
+        if (terminals.empty()) {
+            return;
+        }
+
+        std::optional<size_t> orderIndex = block->locate(terminals.front());
+
+        if (orderIndex.has_value()) {
+            this->statistics.removedStatementCount += block->eraseStatements(*orderIndex + 1);
+        }
+    }
+
+    void DeadCodeEliminationPass::eliminateUnreachableTopLevelConstructs(
+        const std::shared_ptr<Module>& module
+    ) {
+        Context::Scope& globalScope = module->context->globalScope;
+        std::vector<std::string> pendingNames{};
+
+        for (const auto& exportedName : this->exportedNames) {
+            if (globalScope.contains(exportedName)) {
+                pendingNames.push_back(exportedName);
+            }
+        }
+
+        /**
+         * Without any root, the module is likely a library whose exports
+         * are unknown, and everything must be assumed reachable.
+         */
+        if (pendingNames.empty()) {
+            return;
+        }
+
+        std::unordered_set<std::string> reachableNames{};
+        ReferenceCollector referenceCollector{pendingNames};
+
+        while (!pendingNames.empty()) {
+            std::string name = std::move(pendingNames.back());
+
+            pendingNames.pop_back();
+
+            if (!reachableNames.insert(name).second) {
+                continue;
+            }
+
+            ionshared::OptPtr<Construct> topLevelConstruct = globalScope.lookup(name);
+
+            if (ionshared::util::hasValue(topLevelConstruct)) {
+                referenceCollector.visit(*topLevelConstruct);
+            }
+        }
+
+        for (const auto& [name, topLevelConstruct] : globalScope.getEntries()) {
+            if (reachableNames.contains(*name)) {
+                continue;
+            }
+
+            // Externs are declarations only, and lowering emits nothing for unused ones.
+            if (topLevelConstruct->constructKind == ConstructKind::Function) {
+                globalScope.remove(*name);
+                this->statistics.removedFunctionCount++;
+            }
+            else if (topLevelConstruct->constructKind == ConstructKind::Global) {
+                globalScope.remove(*name);
+                this->statistics.removedGlobalCount++;
+            }
+        }
+    }
+
+    DeadCodeEliminationPass::DeadCodeEliminationPass(
+        std::shared_ptr<ionshared::PassContext> context,
+        std::unordered_set<std::string> exportedNames
+    ) noexcept :
+        Pass(std::move(context)),
+        statistics(),
+        exportedNames(std::move(exportedNames)) {
+        //
+    }
+
+    void DeadCodeEliminationPass::leaveConstruct(const std::shared_ptr<Construct>& construct) {
+        if (construct->constructKind == ConstructKind::Block) {
+            std::shared_ptr<Block> block = construct->staticCast<Block>();
+
+            this->eliminateBranches(block);
+            this->eliminateUnreachableStatements(block);
+        }
+        else if (construct->constructKind == ConstructKind::Module) {
+            this->eliminateUnreachableTopLevelConstructs(construct->staticCast<Module>());
+        }
+    }
+
+    const DeadCodeEliminationStatistics& DeadCodeEliminationPass::getStatistics() const noexcept {
+        return this->statistics;
+    }
+}
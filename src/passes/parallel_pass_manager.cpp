@@ -0,0 +1,363 @@
+#include <exception>
+#include <stdexcept>
+#include <ionlang/passes/fused_pass.h>
+#include <ionlang/passes/parallel_pass_manager.h>
+#include <ionlang/tracking/compile_profiler.h>
+#include <ionlang/tracking/trace_recorder.h>
+
+namespace ionlang {
+    /**
+     * Whether the traversal runs the named pass, either as itself or
+     * as one of the passes fused into it.
+     */
+    static bool containsPass(const PassRegistration& traversal, const std::string& name) {
+        if (traversal.fusedNames.empty()) {
+            return *traversal.name == name;
+        }
+
+        for (const auto& fusedName : traversal.fusedNames) {
+            if (*fusedName == name) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Whether the registration depends on the completion of any of the
+     * provided traversals, such that it must not share their traversal
+     * nor their stage.
+     */
+    static bool dependsOnCompletionOf(
+        const PassRegistration& registration,
+        const std::vector<PassRegistration>& traversals
+    ) {
+        for (const auto& completedDependency : registration.schedule.completedDependencies) {
+            for (const auto& traversal : traversals) {
+                if (containsPass(traversal, completedDependency)) {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    static bool canFuse(
+        const std::vector<PassRegistration>& group,
+        const PassRegistration& registration
+    ) {
+        if (!registration.schedule.isFusible
+            || !group.front().schedule.isFusible
+            || registration.kind != group.front().kind) {
+            return false;
+        }
+
+        return !dependsOnCompletionOf(registration, group);
+    }
+
+    static PassRegistration fuse(const std::vector<PassRegistration>& group) {
+        std::string name{};
+        std::vector<PassFactory> factories{};
+        PassSchedule schedule{true};
+        std::vector<InternedName> fusedNames{};
+
+        for (const auto& registration : group) {
+            name += name.empty() ? *registration.name : " + " + *registration.name;
+            factories.push_back(registration.factory);
+
+            // Later stages must still see what the members depend on the completion of.
+            schedule.completedDependencies.insert(
+                schedule.completedDependencies.end(),
+                registration.schedule.completedDependencies.begin(),
+                registration.schedule.completedDependencies.end()
+            );
+
+            fusedNames.push_back(registration.name);
+        }
+
+        PassFactory factory = [factories = std::move(factories)](
+            std::shared_ptr<ionshared::PassContext> context
+        ) {
+            std::vector<std::shared_ptr<Pass>> passes{};
+
+            for (const auto& memberFactory : factories) {
+                passes.push_back(memberFactory(context));
+            }
+
+            return std::make_shared<FusedPass>(std::move(context), std::move(passes));
+        };
+
+        return PassRegistration{
+            group.front().kind,
+            std::move(factory),
+            NameInterner::getGlobal().intern(name),
+            std::move(schedule),
+            std::move(fusedNames)
+        };
+    }
+
+    std::vector<std::shared_ptr<Function>> ParallelPassManager::collectFunctions(
+        const std::shared_ptr<Module>& module
+    ) {
+        std::vector<std::shared_ptr<Function>> functions{};
+
+        for (const auto& [name, construct] : module->context->globalScope.getEntries()) {
+            if (construct->constructKind == ConstructKind::Function) {
+                functions.push_back(construct->staticCast<Function>());
+            }
+        }
+
+        return functions;
+    }
+
+    ParallelPassManager::ParallelPassManager(size_t threadCount) :
+        passes(),
+        workStealingPool(threadCount) {
+        //
+    }
+
+    size_t ParallelPassManager::getThreadCount() const noexcept {
+        return this->workStealingPool.getWorkerCount();
+    }
+
+    std::vector<PassRegistration> ParallelPassManager::orderPasses() const {
+        size_t passCount = this->passes.size();
+        std::vector<std::vector<size_t>> dependencyIndices(passCount);
+
+        for (size_t i = 0; i < passCount; i++) {
+            const PassSchedule& schedule = this->passes[i].schedule;
+            std::vector<std::string> dependencies = schedule.dependencies;
+
+            dependencies.insert(
+                dependencies.end(),
+                schedule.completedDependencies.begin(),
+                schedule.completedDependencies.end()
+            );
+
+            for (const auto& dependency : dependencies) {
+                size_t dependencyIndex = 0;
+
+                while (dependencyIndex < passCount && *this->passes[dependencyIndex].name != dependency) {
+                    dependencyIndex++;
+                }
+
+                if (dependencyIndex == passCount) {
+                    throw std::runtime_error(
+                        "Pass '" + *this->passes[i].name + "' depends on unregistered pass '" + dependency + "'"
+                    );
+                }
+
+                dependencyIndices[i].push_back(dependencyIndex);
+            }
+        }
+
+        std::vector<PassRegistration> orderedPasses{};
+        std::vector<bool> isOrdered(passCount, false);
+
+        // Repeatedly take the earliest registered pass whose dependencies were all taken.
+        while (orderedPasses.size() < passCount) {
+            size_t readyIndex = 0;
+
+            for (; readyIndex < passCount; readyIndex++) {
+                if (isOrdered[readyIndex]) {
+                    continue;
+                }
+
+                bool isReady = true;
+
+                for (size_t dependencyIndex : dependencyIndices[readyIndex]) {
+                    isReady = isReady && isOrdered[dependencyIndex];
+                }
+
+                if (isReady) {
+                    break;
+                }
+            }
+
+            if (readyIndex == passCount) {
+                throw std::runtime_error("Pass dependencies are cyclic");
+            }
+
+            isOrdered[readyIndex] = true;
+            orderedPasses.push_back(this->passes[readyIndex]);
+        }
+
+        return orderedPasses;
+    }
+
+    void ParallelPassManager::registerPass(
+        PassKind kind,
+        PassFactory factory,
+        std::string name,
+        PassSchedule schedule
+    ) {
+        this->passes.push_back(PassRegistration{
+            kind,
+            std::move(factory),
+            NameInterner::getGlobal().intern(name),
+            std::move(schedule)
+        });
+    }
+
+    void ParallelPassManager::registerModulePass(
+        PassFactory factory,
+        std::string name,
+        PassSchedule schedule
+    ) {
+        this->registerPass(PassKind::Module, std::move(factory), std::move(name), std::move(schedule));
+    }
+
+    void ParallelPassManager::registerFunctionPass(
+        PassFactory factory,
+        std::string name,
+        PassSchedule schedule
+    ) {
+        this->registerPass(PassKind::Function, std::move(factory), std::move(name), std::move(schedule));
+    }
+
+    std::vector<PassRegistration> ParallelPassManager::planTraversals() const {
+        std::vector<PassRegistration> orderedPasses = this->orderPasses();
+        std::vector<PassRegistration> traversals{};
+        size_t passIndex = 0;
+
+        while (passIndex < orderedPasses.size()) {
+            std::vector<PassRegistration> group{orderedPasses[passIndex]};
+
+            passIndex++;
+
+            while (passIndex < orderedPasses.size() && canFuse(group, orderedPasses[passIndex])) {
+                group.push_back(orderedPasses[passIndex]);
+                passIndex++;
+            }
+
+            traversals.push_back(group.size() == 1 ? group.front() : fuse(group));
+        }
+
+        return traversals;
+    }
+
+    void ParallelPassManager::runFunctionStage(
+        const std::vector<PassRegistration>& registrations,
+        const std::vector<std::shared_ptr<Function>>& functions,
+        const std::shared_ptr<ionshared::PassContext>& context
+    ) {
+        size_t workerCount = this->workStealingPool.getWorkerCount();
+        bool isProfiling = CompileProfiler::isEnabled();
+
+        // Pass instances of each worker, created by the worker upon its first task.
+        std::vector<std::vector<std::shared_ptr<Pass>>> workerPasses(workerCount);
+
+        /**
+         * Measurements of each worker in each pass. Accumulated locally,
+         * so that profiling does not serialize workers on the profiler.
+         * Hardware counters are read on the worker's own thread.
+         */
+        std::vector<std::vector<PhaseSample>> workerSamples(
+            workerCount,
+            std::vector<PhaseSample>(registrations.size())
+        );
+
+        // Errors, indexed by function.
+        std::vector<std::exception_ptr> errors(functions.size());
+
+        this->workStealingPool.run(functions.size(), [&](size_t taskIndex, size_t workerIndex) {
+            try {
+                std::vector<std::shared_ptr<Pass>>& passes = workerPasses[workerIndex];
+
+                if (passes.empty()) {
+                    for (const auto& registration : registrations) {
+                        passes.push_back(registration.factory(context));
+                    }
+                }
+
+                for (size_t i = 0; i < passes.size(); i++) {
+                    TraceSpan passSpan{*registrations[i].name};
+
+                    if (passSpan.isRecording()) {
+                        passSpan.setDetail(functions[taskIndex]->prototype->name);
+                    }
+
+                    if (!isProfiling) {
+                        passes[i]->visit(functions[taskIndex]);
+
+                        continue;
+                    }
+
+                    PhaseSampler sampler{};
+
+                    passes[i]->visit(functions[taskIndex]);
+
+                    PhaseSample sample = sampler.finish();
+
+                    sample.unitCount = 1;
+                    workerSamples[workerIndex][i] += sample;
+                }
+            }
+            catch (...) {
+                errors[taskIndex] = std::current_exception();
+            }
+        });
+
+        if (isProfiling) {
+            for (size_t i = 0; i < registrations.size(); i++) {
+                PhaseSample sample{};
+
+                for (const auto& samples : workerSamples) {
+                    sample += samples[i];
+                }
+
+                CompileProfiler::recordPhase(
+                    *registrations[i].name,
+                    CompileProfiler::getPhaseDepth(),
+                    sample,
+                    "functions"
+                );
+            }
+        }
+
+        for (const auto& error : errors) {
+            if (error != nullptr) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    void ParallelPassManager::run(
+        const std::shared_ptr<Module>& module,
+        const std::shared_ptr<ionshared::PassContext>& context
+    ) {
+        std::vector<PassRegistration> traversals = this->planTraversals();
+        size_t passIndex = 0;
+
+        while (passIndex < traversals.size()) {
+            if (traversals[passIndex].kind == PassKind::Module) {
+                PhaseTimer passTimer{*traversals[passIndex].name};
+                TraceSpan passSpan{*traversals[passIndex].name};
+
+                traversals[passIndex].factory(context)->visit(module);
+                passIndex++;
+
+                continue;
+            }
+
+            std::vector<PassRegistration> stageRegistrations{};
+
+            // A pass depending on the completion of a pass of the stage starts the next stage.
+            while (passIndex < traversals.size()
+                && traversals[passIndex].kind == PassKind::Function
+                && !dependsOnCompletionOf(traversals[passIndex], stageRegistrations)) {
+                stageRegistrations.push_back(traversals[passIndex]);
+                passIndex++;
+            }
+
+            // Module passes may have declared functions, so they're collected for each stage.
+            this->runFunctionStage(
+                stageRegistrations,
+                ParallelPassManager::collectFunctions(module),
+                context
+            );
+        }
+    }
+}
@@ -1,4 +1,4 @@
-#include <ionlang/passes/pass.h>
+#include <ionlang/passes/construct_dispatch.h>
 
 namespace ionlang {
     Pass::Pass(std::shared_ptr<ionshared::PassContext> context) :
@@ -7,16 +7,18 @@ namespace ionlang {
     }
 
     void Pass::visit(std::shared_ptr<Construct> construct) {
-        // TODO: Hotfix for circular dep.
-        if (construct->constructKind == ConstructKind::Resolvable) {
-            this->visitResolvable(construct->staticCast<Resolvable<>>());
+        this->enterConstruct(construct);
+
+        try {
+            this->visitChildren(construct);
         }
-        // TODO: This should be at the top alone with visitChildren() once fixed.
-        else {
-            construct->accept(*this);
+        catch (...) {
+            this->abortConstruct(construct);
+
+            throw;
         }
 
-        this->visitChildren(construct);
+        this->leaveConstruct(construct);
     }
 
     void Pass::visitChildren(std::shared_ptr<Construct> construct) {
@@ -32,6 +34,19 @@ namespace ionlang {
         }
     }
 
+    void Pass::enterConstruct(const std::shared_ptr<Construct>& construct) {
+        // A single virtual call into the visit method, instead of accept() and then it.
+        dispatchConstruct(*this, construct);
+    }
+
+    void Pass::leaveConstruct(const std::shared_ptr<Construct>& construct) {
+        //
+    }
+
+    void Pass::abortConstruct(const std::shared_ptr<Construct>& construct) {
+        //
+    }
+
     void Pass::visitModule(std::shared_ptr<Module> construct) {
         //
     }
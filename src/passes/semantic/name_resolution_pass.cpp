@@ -6,23 +6,37 @@ namespace ionlang {
         std::string name,
         const std::shared_ptr<Construct>& owner
     ) {
-        if (owner->constructKind != ConstructKind::Block) {
-            // TODO: Better error.
-            throw std::runtime_error("Cannot resolve entity reference when owner is not a block");
+        ionshared::OptPtr<Module> parentModule = std::nullopt;
+
+        // Global initializers are resolved from the module itself.
+        if (owner->constructKind == ConstructKind::Module) {
+            parentModule = owner->staticCast<Module>();
         }
+        else if (owner->constructKind == ConstructKind::Block) {
+            ionshared::OptPtr<Function> parentFunction =
+                owner->staticCast<Block>()->findParentFunction();
 
-        ionshared::OptPtr<Function> parentFunction =
-            owner->dynamicCast<Block>()->findParentFunction();
+            if (!ionshared::util::hasValue(parentFunction)) {
+                // TODO: Use diagnostics.
+                throw std::runtime_error("Could not find parent function of block");
+            }
 
-        if (!ionshared::util::hasValue(parentFunction)) {
+            parentModule = owner->findEnclosingModule();
+        }
+        else {
+            // TODO: Better error.
+            throw std::runtime_error("Cannot resolve entity reference when owner is not a block or module");
+        }
+
+        if (!ionshared::util::hasValue(parentModule)) {
             // TODO: Use diagnostics.
-            throw std::runtime_error("Could not find parent function of block");
+            throw std::runtime_error("Could not find parent module of block");
         }
 
-        auto rootModuleSymbolTable =
-            parentFunction->get()->forceGetUnboxedParent()->context->globalScope;
+        const Context::Scope& rootModuleSymbolTable =
+            parentModule->get()->context->globalScope;
 
-        auto lookupResult = rootModuleSymbolTable->lookup(std::move(name));
+        ionshared::OptPtr<Construct> lookupResult = rootModuleSymbolTable.lookup(name);
 
         if (!ionshared::util::hasValue(lookupResult)) {
             return std::nullopt;
@@ -35,13 +49,48 @@ namespace ionlang {
         std::shared_ptr<ionshared::PassContext> context
     ) noexcept :
         Pass(std::move(context)),
-        scope() {
+        scopeStack() {
         //
     }
 
-    void NameResolutionPass::visitModule(std::shared_ptr<Module> node) {
-        // TODO: Is it push_back() or push_front()?
-        this->scope.push_back(node->context->globalScope);
+    void NameResolutionPass::enterConstruct(const std::shared_ptr<Construct>& construct) {
+        if (construct->constructKind == ConstructKind::Block) {
+            this->scopeStack.push();
+        }
+
+        Pass::enterConstruct(construct);
+    }
+
+    void NameResolutionPass::leaveConstruct(const std::shared_ptr<Construct>& construct) {
+        if (construct->constructKind == ConstructKind::Block) {
+            this->scopeStack.pop();
+
+            return;
+        }
+
+        /**
+         * The declaration is bound after its type and initializer were
+         * walked, so that the initializer cannot refer to the variable
+         * being declared.
+         */
+        if (construct->constructKind == ConstructKind::Statement
+            && construct->staticCast<Statement>()->statementKind == StatementKind::VariableDeclaration
+            && !this->scopeStack.isEmpty()) {
+            std::shared_ptr<VariableDeclStmt> variableDecl =
+                construct->staticCast<VariableDeclStmt>();
+
+            this->scopeStack.declare(
+                NameInterner::getGlobal().intern(variableDecl->name),
+                variableDecl
+            );
+        }
+    }
+
+    void NameResolutionPass::abortConstruct(const std::shared_ptr<Construct>& construct) {
+        // Pop the block's scope even if resolution failed within it.
+        if (construct->constructKind == ConstructKind::Block) {
+            this->scopeStack.pop();
+        }
     }
 
     void NameResolutionPass::visitResolvable(PtrResolvable<> node) {
@@ -52,9 +101,17 @@ namespace ionlang {
 
         /**
          * NOTE: If the resolvable is not resolved, it's guaranteed
-         * to have its kind, name and context defined.
+         * to have its kind, name and context defined. The context is
+         * not owned by the resolvable however, so it may be gone.
          */
-        std::shared_ptr<Construct> owner = *node->context;
+        ionshared::OptPtr<Construct> ownerResult = node->findContext();
+
+        if (!ionshared::util::hasValue(ownerResult)) {
+            // TODO: Use diagnostics API (internal error?).
+            throw std::runtime_error("Resolvable context was already released");
+        }
+
+        std::shared_ptr<Construct> owner = *ownerResult;
         std::string name = ***node->id;
 
         auto throwUndefinedReference = [name]{
@@ -70,51 +127,20 @@ namespace ionlang {
 
         switch (*node->resolvableKind) {
             case ResolvableKind::VariableLike: {
-                // TODO: Must use flow graph to find variable declarations from other blocks (remember blocks can be nested).
-
-                if (owner->constructKind != ConstructKind::Block) {
-                    // TODO: Use diagnostics API (internal error?).
-                    throw std::runtime_error("Cannot resolve variable declaration when owner is not a block");
-                }
+                // TODO: Arguments and global variables are not bound on the scope stack yet.
 
-                ionshared::OptPtr<Construct> valueLookupResult{std::nullopt};
-                std::shared_ptr<Block> ownerBlock = owner->dynamicCast<Block>();
+                // A name which was never interned cannot have been declared.
+                std::optional<InternedName> internedName = NameInterner::getGlobal().find(name);
 
-                ownerBlock->traverseScopes(ownerBlock, [&](auto scope) -> bool {
-                    ionshared::OptPtr<Construct> symbolResult = scope->symbolTable->lookup(name);
+                std::optional<ScopeBinding> binding = internedName.has_value()
+                    ? this->scopeStack.lookup(*internedName)
+                    : std::nullopt;
 
-                    if (!ionshared::util::hasValue(symbolResult)) {
-                        return true;
-                    }
-
-                    // TODO: Simplify code.
-                    std::shared_ptr<Construct> symbol = *symbolResult;
-
-                    // TODO: Doesn't make any sense. Argument list isn't part of a scope.
-                    if (symbol->constructKind == ConstructKind::ArgumentList) {
-                        throw std::runtime_error("Not yet implemented");
-                    }
-                    else if (symbol->constructKind == ConstructKind::Statement
-                        && symbol->template dynamicCast<Statement>()->statementKind
-                            == StatementKind::VariableDeclaration) {
-                        valueLookupResult = symbol->template dynamicCast<VariableDeclStmt>();
-                    }
-                    else {
-                        return true;
-                    }
-
-                    valueLookupResult = symbol;
-
-                    return false;
-
-                    return true;
-                });
-
-                if (!ionshared::util::hasValue(valueLookupResult)) {
+                if (!binding.has_value()) {
                     throwUndefinedReference();
                 }
 
-                node->resolve(*valueLookupResult);
+                node->resolve(this->scopeStack.get(*binding));
 
                 break;
             }
@@ -229,13 +255,7 @@ namespace ionlang {
 //        }
     }
 
-    void NameResolutionPass::visitScopeAnchor(std::shared_ptr<Scoped> node) {
-        // TODO: ScopeStack should be pushed & popped, but its never popped.
-        // TODO: CRITICAL: Throwing SEGFAULT because node is NULL (casting fails).
-        //        this->scopeStack.add(node->getSymbolTable());
-    }
-
-    const std::list<ionshared::PtrSymbolTable<Construct>> &NameResolutionPass::getScope() const {
-        return this->scope;
+    const ScopeStack<VariableDeclStmt>& NameResolutionPass::getScopeStack() const noexcept {
+        return this->scopeStack;
     }
 }
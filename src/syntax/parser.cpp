@@ -1,6 +1,8 @@
 #include <ionlang/const/const.h>
 #include <ionlang/lexical/classifier.h>
 #include <ionlang/syntax/parser.h>
+#include <ionlang/tracking/compile_profiler.h>
+#include <ionlang/tracking/trace_recorder.h>
 
 namespace ionlang {
     bool Parser::is(TokenKind tokenKind) noexcept {
@@ -154,9 +156,12 @@ namespace ionlang {
             // Skip the equal symbol before continuing parsing.
             this->tokenStream.skip();
 
-            // TODO: Not proper parent.
-            // TODO: What about full expressions on globals?
-            valueResult = this->parseLiteral(parent);
+            /**
+             * Any expression is accepted, references within it being
+             * resolved from the module. Whether it is a constant is
+             * only known once it was folded, ahead of lowering.
+             */
+            valueResult = this->parseExpression(parent);
 
             IONLANG_PARSER_ASSERT(util::hasValue(valueResult))
         }
@@ -185,10 +190,8 @@ namespace ionlang {
         IONLANG_PARSER_ASSERT(structNameResult.has_value())
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolBraceL))
 
-        Fields fields = ionshared::util::makePtrSymbolTable<Resolvable<Type>>();
-
-        ionshared::PtrSymbolTable<Method> methods =
-            ionshared::util::makePtrSymbolTable<Method>();
+        Fields fields{};
+        Methods methods{};
 
         TokenKind currentTokenKind = this->tokenStream.get().kind;
 
@@ -210,7 +213,7 @@ namespace ionlang {
                  * A field with the same name was already previously
                  * parsed and set on the fields map.
                  */
-                if (fields->contains(*fieldNameResult)) {
+                if (fields.contains(*fieldNameResult)) {
                     this->diagnosticBuilder
                         ->bootstrap(diagnostic::structFieldRedefinition)
                         ->formatMessage(*fieldNameResult, *structNameResult)
@@ -220,7 +223,7 @@ namespace ionlang {
                     return this->makeErrorMarker();
                 }
 
-                fields->set(*fieldNameResult, util::getResultValue(fieldTypeResult));
+                fields.set(*fieldNameResult, util::getResultValue(fieldTypeResult));
             }
             // Method.
             else if (Classifier::isMethodOrFunction(currentTokenKind)) {
@@ -235,7 +238,7 @@ namespace ionlang {
                  * A field with the same name was already previously
                  * parsed and set on the fields map.
                  */
-                if (methods->contains(method->prototype->name)) {
+                if (methods.contains(method->prototype->name)) {
                     this->diagnosticBuilder
                         ->bootstrap(diagnostic::structMethodRedefinition)
                         ->formatMessage(method->prototype->name, *structNameResult)
@@ -244,6 +247,8 @@ namespace ionlang {
 
                     return this->makeErrorMarker();
                 }
+
+                methods.set(method->prototype->name, method);
             }
 
             // TODO: What if reached here?
@@ -253,8 +258,8 @@ namespace ionlang {
 
         std::shared_ptr<StructType> structType = StructType::make(
             *structNameResult,
-            fields,
-            methods
+            std::move(fields),
+            std::move(methods)
         );
 
         structType->setParent(parent);
@@ -283,6 +288,9 @@ namespace ionlang {
     }
 
     AstPtrResult<Module> Parser::parseModule() {
+        PhaseTimer timer{"parsing"};
+        TraceSpan span{"Parser::parseModule"};
+
         // TODO: This should be present anywhere IONLANG_PARSER_ASSERT is used, because it invokes the finalizer.
         this->beginSourceLocationMapping();
 
@@ -293,15 +301,13 @@ namespace ionlang {
         IONLANG_PARSER_ASSERT(id.has_value())
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolBraceL))
 
-        Context::Scope globalScope =
-            ionshared::util::makePtrSymbolTable<Construct>();
-
-        std::shared_ptr<Module> module =
-            std::make_shared<Module>(*id, std::make_shared<Context>(globalScope));
+        std::shared_ptr<Module> module = std::make_shared<Module>(*id);
+        Context::Scope& globalScope = module->context->globalScope;
 
         this->moduleBuffer = module;
 
         while (!this->is(TokenKind::SymbolBraceR)) {
+            TraceSpan constructSpan{"Parser::parseTopLevelConstruct"};
             AstPtrResult<> topLevelConstructResult = this->parseTopLevelConstruct(module);
 
             // TODO: Make notice if it has no value? Or is it enough with the notice under 'parseTopLevel()'?
@@ -311,8 +317,12 @@ namespace ionlang {
 
                 IONLANG_PARSER_ASSERT(name.has_value())
 
+                if (constructSpan.isRecording()) {
+                    constructSpan.setDetail(*name);
+                }
+
                 // TODO: Ensure we're not re-defining something, issue a notice otherwise.
-                globalScope->set(*name, topLevelConstruct);
+                globalScope.set(*name, topLevelConstruct);
             }
 
             // No more tokens to process.
@@ -334,6 +344,7 @@ namespace ionlang {
 
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolBraceR))
         this->finishSourceLocationMapping(module);
+        timer.setUnits("constructs", globalScope.getSize());
 
         return module;
     }
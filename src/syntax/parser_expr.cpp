@@ -3,7 +3,7 @@
 #include <ionlang/syntax/parser.h>
 
 namespace ionlang {
-    AstPtrResult<Expression<>> Parser::parseExpression(const std::shared_ptr<Block>& parent) {
+    AstPtrResult<Expression<>> Parser::parseExpression(const std::shared_ptr<Construct>& parent) {
         AstPtrResult<Expression<>> primaryExpression = this->parsePrimaryExpr(parent);
 
         IONLANG_PARSER_ASSERT(util::hasValue(primaryExpression))
@@ -20,7 +20,7 @@ namespace ionlang {
         ));
     }
 
-    AstPtrResult<Expression<>> Parser::parsePrimaryExpr(const std::shared_ptr<Block>& parent) {
+    AstPtrResult<Expression<>> Parser::parsePrimaryExpr(const std::shared_ptr<Construct>& parent) {
         if (this->is(TokenKind::SymbolParenthesesL)) {
             return this->parseParenthesesExpr(parent);
         }
@@ -39,7 +39,7 @@ namespace ionlang {
         return util::getResultValue(literal);
     }
 
-    AstPtrResult<Expression<>> Parser::parseParenthesesExpr(const std::shared_ptr<Block>& parent) {
+    AstPtrResult<Expression<>> Parser::parseParenthesesExpr(const std::shared_ptr<Construct>& parent) {
         this->beginSourceLocationMapping();
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolParenthesesL))
 
@@ -51,7 +51,7 @@ namespace ionlang {
         return expression;
     }
 
-    AstPtrResult<Expression<>> Parser::parseIdExpr(const std::shared_ptr<Block>& parent) {
+    AstPtrResult<Expression<>> Parser::parseIdExpr(const std::shared_ptr<Construct>& parent) {
         this->beginSourceLocationMapping();
 
         if (this->isNext(TokenKind::SymbolParenthesesL)) {
@@ -73,7 +73,7 @@ namespace ionlang {
     AstPtrResult<Expression<>> Parser::parseOperationExpr(
         uint32_t minimumOperatorPrecedence,
         std::shared_ptr<Expression<>> leftSideExpression,
-        const std::shared_ptr<Block>& parent
+        const std::shared_ptr<Construct>& parent
     ) {
         auto isOperatorAndPrecedenceGraterThan = [](TokenKind tokenKind, uint32_t precedence) -> bool {
             return Classifier::isIntrinsicOperator(tokenKind)
@@ -129,7 +129,7 @@ namespace ionlang {
         return leftSideExpression;
     }
 
-    AstPtrResult<CallExpr> Parser::parseCallExpr(const std::shared_ptr<Block>& parent) {
+    AstPtrResult<CallExpr> Parser::parseCallExpr(const std::shared_ptr<Construct>& parent) {
         this->beginSourceLocationMapping();
 
         AstPtrResult<Identifier> calleeId = this->parseIdentifier();
@@ -179,7 +179,7 @@ namespace ionlang {
     }
 
     AstPtrResult<StructDefExpr> Parser::parseStructDefExpr(
-        const std::shared_ptr<Block>& parent
+        const std::shared_ptr<Construct>& parent
     ) {
         this->beginSourceLocationMapping();
 
@@ -214,7 +214,7 @@ namespace ionlang {
         return structDefinition;
     }
 
-    AstPtrResult<CastExpr> Parser::parseCastExpr(const std::shared_ptr<Block>& parent) {
+    AstPtrResult<CastExpr> Parser::parseCastExpr(const std::shared_ptr<Construct>& parent) {
         this->beginSourceLocationMapping();
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolParenthesesL))
 
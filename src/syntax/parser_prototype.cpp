@@ -6,8 +6,7 @@ namespace ionlang {
     AstPtrResult<ArgumentList> Parser::parseArgumentList(const std::shared_ptr<Construct>& parent) {
         this->beginSourceLocationMapping();
 
-        ionshared::PtrSymbolTable<Construct> symbolTable =
-            ionshared::util::makePtrSymbolTable<Construct>();
+        ScopeTable<Construct> symbolTable{};
 
         bool isVariable = false;
 
@@ -16,7 +15,7 @@ namespace ionlang {
             if (this->is(TokenKind::SymbolComma)) {
                 // TODO: Only occurring when the argument list is empty, not when there's no more args to process.
                 // Warn about leading, lonely comma.
-                if (symbolTable->isEmpty()) {
+                if (symbolTable.isEmpty()) {
                     this->diagnosticBuilder
                         ->bootstrap(diagnostic::syntaxLeadingCommaInArgs)
                         ->setSourceLocation(this->makeSourceLocation())
@@ -42,12 +41,12 @@ namespace ionlang {
 
             IONLANG_PARSER_ASSERT(name.has_value())
 
-            symbolTable->set(*name, util::getResultValue(type));
+            symbolTable.set(*name, util::getResultValue(type));
         }
         while (this->is(TokenKind::SymbolComma));
 
         std::shared_ptr<ArgumentList> argumentList =
-            ArgumentList::make(symbolTable, isVariable);
+            ArgumentList::make(std::move(symbolTable), isVariable);
 
         argumentList->setParent(parent);
 
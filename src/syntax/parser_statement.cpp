@@ -8,9 +8,6 @@ namespace ionlang {
 
         AstPtrResult<Statement> statement;
 
-        // TODO: Symbol table is not being used. Variable decls should be registered?
-        ionshared::PtrSymbolTable<Construct> symbolTable = parent->symbolTable;
-
         TokenKind currentTokenKind = this->tokenStream.get().kind;
 
         /**
@@ -207,7 +204,7 @@ namespace ionlang {
         //            finalType->setParent(variableDecl);
         //        }
 
-        parent->symbolTable->set(variableDecl->name, variableDecl);
+        parent->symbolTable.set(variableDecl->name, variableDecl);
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolSemiColon))
         this->finishSourceLocationMapping(variableDecl);
 
@@ -5,15 +5,16 @@
 namespace ionlang {
     // TODO: Consider using Ref<> to register pending type reference if user-defined type is parsed?
     AstPtrResult<Resolvable<Type>> Parser::parseType(const std::shared_ptr<Construct>& parent) {
-        std::shared_ptr<TypeQualifierSet> qualifiers =
-            std::make_shared<TypeQualifierSet>();
+        this->beginSourceLocationMapping();
+
+        TypeQualifiers qualifiers{};
 
         // TODO: Simplify to support const mut &*type.
 
         // 1st qualifier: const (constant).
         if (this->is(TokenKind::QualifierConst)) {
             this->tokenStream.skip();
-            qualifiers->add(TypeQualifier::Constant);
+            qualifiers.add(TypeQualifier::Constant);
         }
 
         // 2nd qualifier: mut (mutable reference or pointer).
@@ -23,19 +24,19 @@ namespace ionlang {
             // Mutable reference.
             if (this->is(TokenKind::SymbolAmpersand)) {
                 this->tokenStream.skip();
-                qualifiers->add(TypeQualifier::Reference);
+                qualifiers.add(TypeQualifier::Reference);
             }
             // Otherwise, it must be a pointer.
             else {
                 IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::SymbolHash))
 
-                qualifiers->add(TypeQualifier::Pointer);
+                qualifiers.add(TypeQualifier::Pointer);
             }
         }
         // 3rd qualifier: reference
         else if (this->is(TokenKind::SymbolAmpersand)) {
             this->tokenStream.skip();
-            qualifiers->add(TypeQualifier::Reference);
+            qualifiers.add(TypeQualifier::Reference);
         }
 
         // Retrieve the current token.
@@ -73,31 +74,60 @@ namespace ionlang {
             throw std::runtime_error("Unexpected token");
         }
 
-        // 4th qualifier: pointer.
-        if (this->is(TokenKind::OperatorMultiplication)) {
+        size_t suffixPointerDepth = 0;
+
+        // 4th qualifier: pointer. Each '*' adds a level of indirection.
+        while (this->is(TokenKind::OperatorMultiplication)) {
             this->tokenStream.skip();
-            qualifiers->add(TypeQualifier::Pointer);
+            suffixPointerDepth++;
         }
 
-        // TODO: What about ** (nested pointers)?
-
-        // TODO: Ensure that at this point type is defined (via visual inspection of code-flow routes).
         // 5th qualifier: nullable.
-        if (this->is(TokenKind::SymbolQuestionMark)) {
+        bool isNullable = this->is(TokenKind::SymbolQuestionMark);
+
+        if (isNullable) {
             this->tokenStream.skip();
+        }
+
+        PtrResolvable<Type> resolvableType = util::getResultValue(type);
+
+        /**
+         * User-defined types are only available after name resolution,
+         * and are shared by all of their uses, so qualifiers cannot be
+         * applied to them.
+         */
+        if (!resolvableType->isResolved()) {
+            if (!qualifiers.isEmpty() || suffixPointerDepth > 0 || isNullable) {
+                this->diagnosticBuilder
+                    ->bootstrap(diagnostic::typeUserDefinedQualified)
+                    ->formatMessage(token.value)
+                    ->setSourceLocation(this->makeSourceLocation())
+                    ->finish();
+
+                return this->makeErrorMarker();
+            }
+
+            this->finishSourceLocationMapping(resolvableType);
+
+            return resolvableType;
+        }
+
+        TypeQualifiers& typeQualifiers = resolvableType->forceGetValue()->qualifiers;
+
+        for (size_t i = 0; i < suffixPointerDepth; i++) {
+            typeQualifiers.addPointer();
+        }
 
-            util::getResultValue(type)
-                ->forceGetValue()
-                ->qualifiers
-                ->add(TypeQualifier::Nullable);
+        if (isNullable) {
+            typeQualifiers.add(TypeQualifier::Nullable);
         }
 
         // TODO: Add support for missing types.
 
-        // TODO: Review. What if type wasn't assigned to? Default to AstPtrResult<Type>?
+        this->finishSourceLocationMapping(resolvableType);
 
         // Create and return the resulting type construct.
-        return type;
+        return resolvableType;
     }
 
     AstPtrResult<VoidType> Parser::parseVoidType(const std::shared_ptr<Construct>& parent) {
@@ -116,7 +146,7 @@ namespace ionlang {
 
     AstPtrResult<BooleanType> Parser::parseBooleanType(
         const std::shared_ptr<Construct>& parent,
-        const std::shared_ptr<TypeQualifierSet>& qualifiers
+        TypeQualifiers qualifiers
     ) {
         IONLANG_PARSER_ASSERT(this->skipOver(TokenKind::TypeBool))
 
@@ -130,7 +160,7 @@ namespace ionlang {
 
     AstPtrResult<IntegerType> Parser::parseIntegerType(
         const std::shared_ptr<Construct>& parent,
-        const std::shared_ptr<TypeQualifierSet>& qualifiers
+        TypeQualifiers qualifiers
     ) {
         TokenKind currentTokenKind = this->tokenStream.get().kind;
 
@@ -168,7 +198,7 @@ namespace ionlang {
 
     AstPtrResult<Resolvable<StructType>> Parser::parseStructType(
         const std::shared_ptr<Construct>& parent,
-        const std::shared_ptr<TypeQualifierSet>& qualifiers
+        TypeQualifiers qualifiers
     ) {
         IONLANG_PARSER_ASSERT(this->expect(TokenKind::Identifier))
 
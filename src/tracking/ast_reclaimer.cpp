@@ -0,0 +1,192 @@
+#include <unordered_set>
+#include <ionlang/tracking/ast_reclaimer.h>
+#include <ionlang/construct/module.h>
+
+namespace ionlang {
+    AstReclaimer& AstReclaimer::getGlobal() {
+        // NOTE: Intentionally leaked, see declaration.
+        static AstReclaimer* globalReclaimer = new AstReclaimer();
+
+        return *globalReclaimer;
+    }
+
+    void AstReclaimer::release(Ast roots) {
+        Ast nodes{};
+        std::unordered_set<const Construct*> visitedNodes{};
+
+        for (auto& root : roots) {
+            /**
+             * If the root is owned elsewhere, dropping it destroys nothing,
+             * so there's no point in collecting its nodes.
+             */
+            if (root != nullptr && root.use_count() == 1 && visitedNodes.insert(root.get()).second) {
+                nodes.push_back(std::move(root));
+            }
+        }
+
+        roots.clear();
+
+        // Collect all reachable nodes, breadth-first.
+        for (size_t i = 0; i < nodes.size(); i++) {
+            for (auto& child : nodes[i]->getChildNodes()) {
+                if (visitedNodes.insert(child.get()).second) {
+                    nodes.push_back(std::move(child));
+                }
+            }
+        }
+
+        /**
+         * Release parents before their children. Since every child is
+         * still being held by the list at the time its parent is destroyed,
+         * each destruction is shallow.
+         */
+        for (auto& node : nodes) {
+            node.reset();
+        }
+    }
+
+    AstReclaimer::AstReclaimer(ReclaimMode mode) :
+        mutex(),
+        jobCondition(),
+        drainCondition(),
+        jobs(),
+        thread(),
+        mode(mode),
+        isStopping(false),
+        pendingJobCount(0) {
+        //
+    }
+
+    AstReclaimer::~AstReclaimer() {
+        {
+            std::lock_guard<std::mutex> lock{this->mutex};
+
+            this->isStopping = true;
+        }
+
+        this->jobCondition.notify_all();
+
+        if (this->thread.joinable()) {
+            this->thread.join();
+        }
+    }
+
+    void AstReclaimer::enqueue(Job job) {
+        {
+            std::unique_lock<std::mutex> lock{this->mutex};
+
+            if (this->mode == ReclaimMode::Background) {
+                // Start the reclamation thread upon first use.
+                if (!this->thread.joinable()) {
+                    this->thread = std::thread(&AstReclaimer::run, this);
+                }
+
+                this->jobs.push_back(std::move(job));
+                this->pendingJobCount++;
+                lock.unlock();
+                this->jobCondition.notify_one();
+
+                return;
+            }
+        }
+
+        /**
+         * The object must be destroyed first, as it may be holding the
+         * roots (for example, a module context holding its top-level
+         * constructs).
+         */
+        job.object.reset();
+        AstReclaimer::release(std::move(job.roots));
+    }
+
+    void AstReclaimer::run() {
+        std::unique_lock<std::mutex> lock{this->mutex};
+
+        while (true) {
+            this->jobCondition.wait(lock, [this] {
+                return this->isStopping || !this->jobs.empty();
+            });
+
+            // Pending jobs are always released before stopping.
+            if (this->jobs.empty()) {
+                return;
+            }
+
+            Job job = std::move(this->jobs.front());
+
+            this->jobs.pop_front();
+
+            // Release outside of the lock, so that callers are never blocked.
+            lock.unlock();
+            job.object.reset();
+            AstReclaimer::release(std::move(job.roots));
+            lock.lock();
+
+            this->pendingJobCount--;
+
+            if (this->pendingJobCount == 0) {
+                this->drainCondition.notify_all();
+            }
+        }
+    }
+
+    ReclaimMode AstReclaimer::getMode() {
+        std::lock_guard<std::mutex> lock{this->mutex};
+
+        return this->mode;
+    }
+
+    void AstReclaimer::setMode(ReclaimMode mode) {
+        {
+            std::lock_guard<std::mutex> lock{this->mutex};
+
+            this->mode = mode;
+        }
+
+        if (mode == ReclaimMode::Synchronous) {
+            this->drain();
+        }
+    }
+
+    void AstReclaimer::reclaim(std::shared_ptr<Construct> root) {
+        Ast roots{};
+
+        // NOTE: An initializer list would copy the root, leaving it shared.
+        roots.push_back(std::move(root));
+        this->reclaim(std::move(roots));
+    }
+
+    void AstReclaimer::reclaim(Ast roots) {
+        this->enqueue(Job{std::move(roots), nullptr});
+    }
+
+    void AstReclaimer::reclaim(std::shared_ptr<Context> context) {
+        // The context may be shared by another module.
+        if (context == nullptr || context.use_count() > 1) {
+            return;
+        }
+
+        Ast roots = Construct::convertChildren(context->globalScope);
+
+        this->enqueue(Job{std::move(roots), std::move(context)});
+    }
+
+    void AstReclaimer::drain() {
+        std::unique_lock<std::mutex> lock{this->mutex};
+
+        // Jobs may be enqueued by the reclamation thread itself, which cannot wait on itself.
+        if (std::this_thread::get_id() == this->thread.get_id()) {
+            return;
+        }
+
+        this->drainCondition.wait(lock, [this] {
+            return this->pendingJobCount == 0;
+        });
+    }
+
+    size_t AstReclaimer::getPendingJobCount() {
+        std::lock_guard<std::mutex> lock{this->mutex};
+
+        return this->pendingJobCount;
+    }
+}
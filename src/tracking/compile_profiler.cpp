@@ -0,0 +1,403 @@
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <mutex>
+#include <ionlang/tracking/compile_profiler.h>
+#include <ionlang/tracking/json_writer.h>
+
+namespace ionlang {
+    static std::mutex profilerMutex{};
+
+    static std::vector<PhaseTiming> phases{};
+
+    static std::vector<FunctionTiming> functions{};
+
+    // Amount of phases currently entered by the calling thread.
+    static thread_local size_t phaseDepth = 0;
+
+    static const std::array<std::string, HardwareCounts::eventCount> hardwareEventNames{
+        "cycles",
+        "instructions",
+        "branchMisses",
+        "cacheMisses"
+    };
+
+    static double toMilliseconds(std::chrono::nanoseconds duration) noexcept {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    static void writeJsonOptional(std::ostream& stream, const std::optional<double>& value) {
+        if (value.has_value()) {
+            stream << *value;
+        }
+        else {
+            stream << "null";
+        }
+    }
+
+    /**
+     * Misses of the provided event per work unit of the sample, printed
+     * as a report column.
+     */
+    static void writeMissesPerUnit(std::ostream& stream, const PhaseSample& sample, HardwareEvent event) {
+        std::optional<uint64_t> misses = sample.hardwareCounts.get(event);
+
+        if (!misses.has_value() || sample.unitCount == 0) {
+            stream << std::setw(14) << "-";
+
+            return;
+        }
+
+        stream << std::setw(14) << std::setprecision(3)
+            << static_cast<double>(*misses) / sample.unitCount;
+    }
+
+    static void writeJsonSourceLocation(
+        std::ostream& stream,
+        const std::optional<ionshared::SourceLocation>& sourceLocation
+    ) {
+        if (!sourceLocation.has_value()) {
+            stream << "null";
+
+            return;
+        }
+
+        stream << "{\"line\":" << sourceLocation->lines.getStartPosition()
+            << ",\"column\":" << sourceLocation->columns.getStartPosition()
+            << "}";
+    }
+
+    PhaseSample& PhaseSample::operator+=(const PhaseSample& other) noexcept {
+        this->duration += other.duration;
+        this->hardwareCounts += other.hardwareCounts;
+        this->unitCount += other.unitCount;
+
+        return *this;
+    }
+
+    PhaseSampler::PhaseSampler() noexcept :
+        startTime(),
+        startHardwareCounts(std::nullopt) {
+        if (CompileProfiler::isHardwareCountersEnabled()) {
+            this->startHardwareCounts = HardwareCounters::getForCurrentThread().read();
+        }
+
+        // Read last, so that reading the counters is not part of the duration.
+        this->startTime = std::chrono::steady_clock::now();
+    }
+
+    PhaseSample PhaseSampler::finish() const noexcept {
+        PhaseSample sample{};
+
+        sample.duration = std::chrono::steady_clock::now() - this->startTime;
+
+        if (this->startHardwareCounts.has_value()) {
+            sample.hardwareCounts =
+                HardwareCounters::getForCurrentThread().read() - *this->startHardwareCounts;
+        }
+
+        return sample;
+    }
+
+    std::atomic<bool> CompileProfiler::enabled{false};
+
+    std::atomic<bool> CompileProfiler::hardwareCountersEnabled{false};
+
+    void CompileProfiler::setEnabled(bool enabled) noexcept {
+        CompileProfiler::enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void CompileProfiler::setHardwareCountersEnabled(bool enabled) noexcept {
+        CompileProfiler::hardwareCountersEnabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void CompileProfiler::reset() {
+        std::lock_guard<std::mutex> lock{profilerMutex};
+
+        phases.clear();
+        functions.clear();
+    }
+
+    /**
+     * Find the phase of the provided name, registering it if needed.
+     * Must be invoked while holding the profiler's lock.
+     */
+    static PhaseTiming& findOrAddPhase(std::string_view name, size_t depth) {
+        // Phases are few, so a linear search is cheaper than hashing.
+        auto phase = std::find_if(phases.begin(), phases.end(), [name](const PhaseTiming& phase) {
+            return phase.name == name;
+        });
+
+        if (phase != phases.end()) {
+            return *phase;
+        }
+
+        return phases.emplace_back(PhaseTiming{
+            std::string(name),
+            depth,
+            0,
+            std::string(),
+            PhaseSample{}
+        });
+    }
+
+    void CompileProfiler::declarePhase(std::string_view name, size_t depth) {
+        std::lock_guard<std::mutex> lock{profilerMutex};
+
+        findOrAddPhase(name, depth);
+    }
+
+    void CompileProfiler::recordPhase(
+        std::string_view name,
+        size_t depth,
+        const PhaseSample& sample,
+        std::string_view unit
+    ) {
+        std::lock_guard<std::mutex> lock{profilerMutex};
+        PhaseTiming& phase = findOrAddPhase(name, depth);
+
+        phase.invocationCount++;
+        phase.sample += sample;
+
+        if (!unit.empty()) {
+            phase.unit = unit;
+        }
+    }
+
+    void CompileProfiler::recordFunction(FunctionTiming timing) {
+        std::lock_guard<std::mutex> lock{profilerMutex};
+
+        functions.push_back(std::move(timing));
+    }
+
+    size_t CompileProfiler::getPhaseDepth() noexcept {
+        return phaseDepth;
+    }
+
+    std::vector<PhaseTiming> CompileProfiler::getPhases() {
+        std::lock_guard<std::mutex> lock{profilerMutex};
+
+        return phases;
+    }
+
+    std::vector<FunctionTiming> CompileProfiler::getSlowestFunctions(size_t count) {
+        std::vector<FunctionTiming> slowestFunctions{};
+
+        {
+            std::lock_guard<std::mutex> lock{profilerMutex};
+
+            slowestFunctions = functions;
+        }
+
+        count = std::min(count, slowestFunctions.size());
+
+        std::partial_sort(
+            slowestFunctions.begin(),
+            slowestFunctions.begin() + count,
+            slowestFunctions.end(),
+
+            [](const FunctionTiming& first, const FunctionTiming& second) {
+                return first.duration > second.duration;
+            }
+        );
+
+        slowestFunctions.resize(count);
+
+        return slowestFunctions;
+    }
+
+    void CompileProfiler::writeReport(std::ostream& stream) {
+        std::vector<PhaseTiming> phaseTimings = CompileProfiler::getPhases();
+        std::chrono::nanoseconds totalDuration{0};
+        bool hasHardwareCounts = false;
+
+        for (const auto& phase : phaseTimings) {
+            if (phase.depth == 0) {
+                totalDuration += phase.sample.duration;
+            }
+
+            hasHardwareCounts = hasHardwareCounts || !phase.sample.hardwareCounts.isEmpty();
+        }
+
+        std::ios_base::fmtflags flags = stream.flags();
+
+        stream << "===-------------------------------------------------------------------------===" << std::endl
+            << "                          Compile time report" << std::endl
+            << "===-------------------------------------------------------------------------===" << std::endl
+            << "  Total wall time: " << std::fixed << std::setprecision(3)
+            << toMilliseconds(totalDuration) << " ms" << std::endl << std::endl
+            << std::right << std::setw(14) << "Wall time (ms)"
+            << std::setw(10) << "%"
+            << std::setw(10) << "Count";
+
+        if (hasHardwareCounts) {
+            stream << std::setw(8) << "IPC"
+                << std::setw(14) << "Br. miss/unit"
+                << std::setw(14) << "LLC miss/unit";
+        }
+
+        stream << "  Name" << std::endl;
+
+        for (const auto& phase : phaseTimings) {
+            double percentage = totalDuration.count() == 0
+                ? 0
+                : 100.0 * phase.sample.duration.count() / totalDuration.count();
+
+            stream << std::setw(14) << std::setprecision(3) << toMilliseconds(phase.sample.duration)
+                << std::setw(9) << std::setprecision(1) << percentage << "%"
+                << std::setw(10) << phase.invocationCount;
+
+            if (hasHardwareCounts) {
+                std::optional<double> instructionsPerCycle =
+                    phase.sample.hardwareCounts.findInstructionsPerCycle();
+
+                if (instructionsPerCycle.has_value()) {
+                    stream << std::setw(8) << std::setprecision(2) << *instructionsPerCycle;
+                }
+                else {
+                    stream << std::setw(8) << "-";
+                }
+
+                writeMissesPerUnit(stream, phase.sample, HardwareEvent::BranchMisses);
+                writeMissesPerUnit(stream, phase.sample, HardwareEvent::CacheMisses);
+            }
+
+            stream << "  " << std::string(phase.depth * 2, ' ') << phase.name;
+
+            if (!phase.unit.empty()) {
+                stream << " (" << phase.sample.unitCount << " " << phase.unit << ")";
+            }
+
+            stream << std::endl;
+        }
+
+        stream.flags(flags);
+    }
+
+    void CompileProfiler::writeJson(std::ostream& stream, size_t slowestFunctionCount) {
+        stream << "{\"enabled\":" << (CompileProfiler::isEnabled() ? "true" : "false");
+        stream << ",\"phases\":[";
+
+        std::vector<PhaseTiming> phaseTimings = CompileProfiler::getPhases();
+
+        for (size_t i = 0; i < phaseTimings.size(); i++) {
+            const PhaseSample& sample = phaseTimings[i].sample;
+
+            if (i > 0) {
+                stream << ",";
+            }
+
+            stream << "{\"name\":";
+            json::writeString(stream, phaseTimings[i].name);
+
+            stream << ",\"depth\":" << phaseTimings[i].depth
+                << ",\"count\":" << phaseTimings[i].invocationCount
+                << ",\"nanoseconds\":" << sample.duration.count()
+                << ",\"unit\":";
+
+            json::writeString(stream, phaseTimings[i].unit);
+            stream << ",\"unitCount\":" << sample.unitCount << ",\"hardwareCounters\":{";
+
+            for (size_t event = 0; event < HardwareCounts::eventCount; event++) {
+                std::optional<uint64_t> count = sample.hardwareCounts.counts[event];
+
+                json::writeString(stream, hardwareEventNames[event]);
+                stream << ":";
+                if (count.has_value()) {
+                    stream << *count;
+                }
+                else {
+                    stream << "null";
+                }
+
+                stream << ",";
+            }
+
+            stream << "\"instructionsPerCycle\":";
+            writeJsonOptional(stream, sample.hardwareCounts.findInstructionsPerCycle());
+            stream << "}}";
+        }
+
+        stream << "],\"slowestFunctions\":[";
+
+        std::vector<FunctionTiming> slowestFunctions =
+            CompileProfiler::getSlowestFunctions(slowestFunctionCount);
+
+        for (size_t i = 0; i < slowestFunctions.size(); i++) {
+            if (i > 0) {
+                stream << ",";
+            }
+
+            stream << "{\"name\":";
+            json::writeString(stream, slowestFunctions[i].name);
+            stream << ",\"sourceLocation\":";
+            writeJsonSourceLocation(stream, slowestFunctions[i].sourceLocation);
+            stream << ",\"nanoseconds\":" << slowestFunctions[i].duration.count() << "}";
+        }
+
+        stream << "]}";
+    }
+
+    PhaseTimer::PhaseTimer(std::string_view name, std::optional<size_t> depth) noexcept :
+        name(name),
+        depth(depth),
+        isNested(!depth.has_value()),
+        sampler(std::nullopt),
+        unit(),
+        unitCount(0) {
+        if (!CompileProfiler::isEnabled()) {
+            return;
+        }
+
+        if (this->isNested) {
+            this->depth = phaseDepth++;
+        }
+
+        CompileProfiler::declarePhase(this->name, *this->depth);
+        this->sampler.emplace();
+    }
+
+    PhaseTimer::~PhaseTimer() {
+        if (!this->sampler.has_value()) {
+            return;
+        }
+
+        PhaseSample sample = this->sampler->finish();
+
+        sample.unitCount = this->unitCount;
+
+        if (this->isNested) {
+            phaseDepth--;
+        }
+
+        CompileProfiler::recordPhase(this->name, *this->depth, sample, this->unit);
+    }
+
+    void PhaseTimer::setUnits(std::string_view unit, size_t unitCount) noexcept {
+        this->unit = unit;
+        this->unitCount = unitCount;
+    }
+
+    FunctionTimer::FunctionTimer(const std::shared_ptr<Function>& function) noexcept :
+        function(nullptr),
+        startTime(std::nullopt) {
+        if (CompileProfiler::isEnabled()) {
+            this->function = function;
+            this->startTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    FunctionTimer::~FunctionTimer() {
+        if (!this->startTime.has_value()) {
+            return;
+        }
+
+        std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - *this->startTime;
+
+        CompileProfiler::recordFunction(FunctionTiming{
+            this->function->prototype->name,
+            this->function->sourceLocation,
+            duration
+        });
+    }
+}
@@ -0,0 +1,195 @@
+#include <ionlang/tracking/hardware_counters.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ionlang {
+#ifdef __linux__
+    static perf_event_attr makeEventAttributes(HardwareEvent event) noexcept {
+        perf_event_attr attributes{};
+
+        attributes.size = sizeof(perf_event_attr);
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+
+        attributes.read_format = PERF_FORMAT_GROUP
+            | PERF_FORMAT_TOTAL_TIME_ENABLED
+            | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        switch (event) {
+            case HardwareEvent::Cycles: {
+                attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+
+                break;
+            }
+
+            case HardwareEvent::Instructions: {
+                attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+
+                break;
+            }
+
+            case HardwareEvent::BranchMisses: {
+                attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+
+                break;
+            }
+
+            case HardwareEvent::CacheMisses: {
+                attributes.type = PERF_TYPE_HW_CACHE;
+
+                attributes.config = PERF_COUNT_HW_CACHE_LL
+                    | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+                break;
+            }
+        }
+
+        return attributes;
+    }
+#endif
+
+    std::optional<uint64_t> HardwareCounts::get(HardwareEvent event) const noexcept {
+        return this->counts[static_cast<size_t>(event)];
+    }
+
+    bool HardwareCounts::isEmpty() const noexcept {
+        for (const auto& count : this->counts) {
+            if (count.has_value()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::optional<double> HardwareCounts::findInstructionsPerCycle() const noexcept {
+        std::optional<uint64_t> cycles = this->get(HardwareEvent::Cycles);
+        std::optional<uint64_t> instructions = this->get(HardwareEvent::Instructions);
+
+        if (!cycles.has_value() || !instructions.has_value() || *cycles == 0) {
+            return std::nullopt;
+        }
+
+        return static_cast<double>(*instructions) / *cycles;
+    }
+
+    HardwareCounts HardwareCounts::operator-(const HardwareCounts& other) const noexcept {
+        HardwareCounts difference{};
+
+        for (size_t i = 0; i < HardwareCounts::eventCount; i++) {
+            if (this->counts[i].has_value() && other.counts[i].has_value()) {
+                // Scaled counts of a multiplexed group may decrease slightly.
+                difference.counts[i] = *this->counts[i] > *other.counts[i]
+                    ? *this->counts[i] - *other.counts[i]
+                    : 0;
+            }
+        }
+
+        return difference;
+    }
+
+    HardwareCounts& HardwareCounts::operator+=(const HardwareCounts& other) noexcept {
+        for (size_t i = 0; i < HardwareCounts::eventCount; i++) {
+            if (other.counts[i].has_value()) {
+                this->counts[i] = this->counts[i].value_or(0) + *other.counts[i];
+            }
+        }
+
+        return *this;
+    }
+
+    HardwareCounters& HardwareCounters::getForCurrentThread() {
+        static thread_local HardwareCounters hardwareCounters{};
+
+        return hardwareCounters;
+    }
+
+    HardwareCounters::HardwareCounters() :
+        openedEvents(),
+        fileDescriptors(),
+        openedEventCount(0) {
+#ifdef __linux__
+        for (size_t i = 0; i < HardwareCounts::eventCount; i++) {
+            HardwareEvent event = static_cast<HardwareEvent>(i);
+            perf_event_attr attributes = makeEventAttributes(event);
+
+            // Measure the calling thread, on any CPU.
+            int fileDescriptor = static_cast<int>(syscall(
+                SYS_perf_event_open,
+                &attributes,
+                0,
+                -1,
+                this->isAvailable() ? this->fileDescriptors[0] : -1,
+                0
+            ));
+
+            // Unsupported, or not permitted.
+            if (fileDescriptor < 0) {
+                continue;
+            }
+
+            this->openedEvents[this->openedEventCount] = event;
+            this->fileDescriptors[this->openedEventCount] = fileDescriptor;
+            this->openedEventCount++;
+        }
+#endif
+    }
+
+    HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+        for (size_t i = 0; i < this->openedEventCount; i++) {
+            close(this->fileDescriptors[i]);
+        }
+#endif
+    }
+
+    bool HardwareCounters::isAvailable() const noexcept {
+        return this->openedEventCount > 0;
+    }
+
+    HardwareCounts HardwareCounters::read() const noexcept {
+        HardwareCounts hardwareCounts{};
+
+#ifdef __linux__
+        if (!this->isAvailable()) {
+            return hardwareCounts;
+        }
+
+        // Event count, time enabled and time running, followed by the values.
+        std::array<uint64_t, 3 + HardwareCounts::eventCount> buffer{};
+        ssize_t expectedSize = static_cast<ssize_t>((3 + this->openedEventCount) * sizeof(uint64_t));
+
+        if (::read(this->fileDescriptors[0], buffer.data(), sizeof(buffer)) != expectedSize) {
+            return hardwareCounts;
+        }
+
+        uint64_t timeEnabled = buffer[1];
+        uint64_t timeRunning = buffer[2];
+
+        // The group never got to run.
+        if (timeRunning == 0) {
+            return hardwareCounts;
+        }
+
+        for (size_t i = 0; i < this->openedEventCount; i++) {
+            uint64_t count = buffer[3 + i];
+
+            if (timeRunning < timeEnabled) {
+                count = static_cast<uint64_t>(
+                    static_cast<double>(count) * timeEnabled / timeRunning
+                );
+            }
+
+            hardwareCounts.counts[static_cast<size_t>(this->openedEvents[i])] = count;
+        }
+#endif
+
+        return hardwareCounts;
+    }
+}
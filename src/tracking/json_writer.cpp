@@ -0,0 +1,73 @@
+#include <iomanip>
+#include <ionlang/tracking/json_writer.h>
+
+namespace ionlang::json {
+    void writeString(std::ostream& stream, std::string_view value) {
+        stream << '"';
+
+        for (char character : value) {
+            switch (character) {
+                case '"': {
+                    stream << "\\\"";
+
+                    break;
+                }
+
+                case '\\': {
+                    stream << "\\\\";
+
+                    break;
+                }
+
+                case '\b': {
+                    stream << "\\b";
+
+                    break;
+                }
+
+                case '\f': {
+                    stream << "\\f";
+
+                    break;
+                }
+
+                case '\n': {
+                    stream << "\\n";
+
+                    break;
+                }
+
+                case '\r': {
+                    stream << "\\r";
+
+                    break;
+                }
+
+                case '\t': {
+                    stream << "\\t";
+
+                    break;
+                }
+
+                default: {
+                    // Remaining control characters have no short escape sequence.
+                    if (static_cast<unsigned char>(character) < 0x20) {
+                        std::ios_base::fmtflags flags = stream.flags();
+                        char fill = stream.fill();
+
+                        stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                            << static_cast<int>(character);
+
+                        stream.flags(flags);
+                        stream.fill(fill);
+                    }
+                    else {
+                        stream << character;
+                    }
+                }
+            }
+        }
+
+        stream << '"';
+    }
+}
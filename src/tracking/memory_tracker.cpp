@@ -0,0 +1,374 @@
+#include <array>
+#include <atomic>
+#include <string>
+#include <ionlang/const/const.h>
+#include <ionlang/passes/pass.h>
+#include <ionlang/tracking/memory_tracker.h>
+#include <ionlang/tracking/json_writer.h>
+
+namespace ionlang {
+    static_assert(static_cast<size_t>(ConstructKind::Method) < MemoryTracker::maxKindCount);
+    static_assert(static_cast<size_t>(StatementKind::BlockWrapper) < MemoryTracker::maxKindCount);
+    static_assert(static_cast<size_t>(ExpressionKind::Cast) < MemoryTracker::maxKindCount);
+    static_assert(static_cast<size_t>(TypeKind::Boolean) < MemoryTracker::maxKindCount);
+
+    static const std::array<std::string, MemoryTracker::subjectCount> subjectNames{
+        "construct",
+        "statement",
+        "expression",
+        "type",
+        "token",
+        "symbolTableEntry",
+        "ionIrNode"
+    };
+
+    static const std::array<std::string, 7> statementKindNames{
+        "if",
+        "return",
+        "variable declaration",
+        "assignment",
+        "call",
+        "expression wrapper",
+        "block wrapper"
+    };
+
+    static const std::array<std::string, 9> expressionKindNames{
+        "call",
+        "operation",
+        "variable reference",
+        "boolean literal",
+        "char literal",
+        "integer literal",
+        "string literal",
+        "struct definition",
+        "cast"
+    };
+
+    static const std::array<std::string, 5> typeKindNames{
+        "struct",
+        "void",
+        "integer",
+        "string",
+        "boolean"
+    };
+
+    template<size_t N>
+    static std::string findKindName(const std::array<std::string, N>& names, uint32_t kind) {
+        return kind < names.size() ? names[kind] : std::to_string(kind);
+    }
+
+    static std::string findKindName(MemorySubject subject, uint32_t kind) {
+        switch (subject) {
+            // IonIR nodes are keyed by the kind of the construct they were lowered from.
+            case MemorySubject::Construct:
+            case MemorySubject::IonIrNode: {
+                std::optional<std::string> name =
+                    Const::findConstructKindName(static_cast<ConstructKind>(kind));
+
+                return name.has_value() ? *name : std::to_string(kind);
+            }
+
+            case MemorySubject::Statement: {
+                return findKindName(statementKindNames, kind);
+            }
+
+            case MemorySubject::Expression: {
+                return findKindName(expressionKindNames, kind);
+            }
+
+            case MemorySubject::Type: {
+                return findKindName(typeKindNames, kind);
+            }
+
+            default: {
+                return std::to_string(kind);
+            }
+        }
+    }
+
+    static void writeJsonCounter(std::ostream& stream, const MemoryCounter& counter) {
+        stream << "{\"liveCount\":" << counter.liveCount
+            << ",\"liveBytes\":" << counter.liveBytes
+            << ",\"peakCount\":" << counter.peakCount
+            << ",\"peakBytes\":" << counter.peakBytes
+            << ",\"totalCount\":" << counter.totalCount
+            << ",\"totalBytes\":" << counter.totalBytes
+            << "}";
+    }
+
+#ifdef IONLANG_MEMORY_TRACKING
+    struct AtomicMemoryCounter {
+        std::atomic<size_t> liveCount{0};
+
+        std::atomic<size_t> liveBytes{0};
+
+        std::atomic<size_t> peakCount{0};
+
+        std::atomic<size_t> peakBytes{0};
+
+        std::atomic<size_t> totalCount{0};
+
+        std::atomic<size_t> totalBytes{0};
+
+        [[nodiscard]] MemoryCounter load() const noexcept {
+            return MemoryCounter{
+                this->liveCount.load(std::memory_order_relaxed),
+                this->liveBytes.load(std::memory_order_relaxed),
+                this->peakCount.load(std::memory_order_relaxed),
+                this->peakBytes.load(std::memory_order_relaxed),
+                this->totalCount.load(std::memory_order_relaxed),
+                this->totalBytes.load(std::memory_order_relaxed)
+            };
+        }
+    };
+
+    static std::array<
+        std::array<AtomicMemoryCounter, MemoryTracker::maxKindCount>,
+        MemoryTracker::subjectCount
+    > kindCounters{};
+
+    static std::array<AtomicMemoryCounter, MemoryTracker::subjectCount> subjectCounters{};
+
+    static void raisePeak(std::atomic<size_t>& peak, size_t value) noexcept {
+        size_t currentPeak = peak.load(std::memory_order_relaxed);
+
+        while (value > currentPeak
+            && !peak.compare_exchange_weak(currentPeak, value, std::memory_order_relaxed)) {
+            //
+        }
+    }
+
+    static void allocate(AtomicMemoryCounter& counter, size_t count, size_t bytes) noexcept {
+        counter.totalCount.fetch_add(count, std::memory_order_relaxed);
+        counter.totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+        raisePeak(
+            counter.peakCount,
+            counter.liveCount.fetch_add(count, std::memory_order_relaxed) + count
+        );
+
+        raisePeak(
+            counter.peakBytes,
+            counter.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes
+        );
+    }
+
+    static void release(AtomicMemoryCounter& counter, size_t count, size_t bytes) noexcept {
+        counter.liveCount.fetch_sub(count, std::memory_order_relaxed);
+        counter.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    static void create(AtomicMemoryCounter& counter, size_t count, size_t bytes) noexcept {
+        counter.totalCount.fetch_add(count, std::memory_order_relaxed);
+        counter.totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * Statements, expressions and types are refinements of a single
+     * construct kind. Their bytes are also accounted on that construct
+     * kind, which only counted the construct itself.
+     */
+    static std::optional<ConstructKind> findRefinedConstructKind(MemorySubject subject) noexcept {
+        switch (subject) {
+            case MemorySubject::Statement: {
+                return ConstructKind::Statement;
+            }
+
+            case MemorySubject::Expression: {
+                return ConstructKind::Expression;
+            }
+
+            case MemorySubject::Type: {
+                return ConstructKind::Type;
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    void MemoryTracker::recordAllocation(MemorySubject subject, uint32_t kind, size_t bytes) noexcept {
+        allocate(kindCounters[static_cast<size_t>(subject)][kind], 1, bytes);
+        allocate(subjectCounters[static_cast<size_t>(subject)], 1, bytes);
+
+        if (std::optional<ConstructKind> constructKind = findRefinedConstructKind(subject)) {
+            size_t constructSubject = static_cast<size_t>(MemorySubject::Construct);
+
+            allocate(kindCounters[constructSubject][static_cast<size_t>(*constructKind)], 0, bytes);
+            allocate(subjectCounters[constructSubject], 0, bytes);
+        }
+    }
+
+    void MemoryTracker::recordRelease(MemorySubject subject, uint32_t kind, size_t bytes) noexcept {
+        release(kindCounters[static_cast<size_t>(subject)][kind], 1, bytes);
+        release(subjectCounters[static_cast<size_t>(subject)], 1, bytes);
+
+        if (std::optional<ConstructKind> constructKind = findRefinedConstructKind(subject)) {
+            size_t constructSubject = static_cast<size_t>(MemorySubject::Construct);
+
+            release(kindCounters[constructSubject][static_cast<size_t>(*constructKind)], 0, bytes);
+            release(subjectCounters[constructSubject], 0, bytes);
+        }
+    }
+
+    void MemoryTracker::recordCreation(
+        MemorySubject subject,
+        uint32_t kind,
+        size_t count,
+        size_t bytes
+    ) noexcept {
+        create(kindCounters[static_cast<size_t>(subject)][kind], count, bytes);
+        create(subjectCounters[static_cast<size_t>(subject)], count, bytes);
+    }
+
+    size_t MemoryTracker::findShallowSize(MemorySubject subject, uint32_t kind) noexcept {
+        switch (subject) {
+            case MemorySubject::Construct: {
+                switch (static_cast<ConstructKind>(kind)) {
+                    case ConstructKind::Prototype: return sizeof(Prototype);
+                    case ConstructKind::Function: return sizeof(Function);
+                    case ConstructKind::Extern: return sizeof(Extern);
+                    case ConstructKind::Global: return sizeof(Global);
+                    case ConstructKind::Block: return sizeof(Block);
+                    case ConstructKind::Module: return sizeof(Module);
+                    case ConstructKind::Resolvable: return sizeof(Resolvable<>);
+                    case ConstructKind::ErrorMarker: return sizeof(ErrorMarker);
+                    case ConstructKind::Attribute: return sizeof(Attribute);
+                    case ConstructKind::ArgumentList: return sizeof(ArgumentList);
+                    case ConstructKind::Identifier: return sizeof(Identifier);
+                    case ConstructKind::Import: return sizeof(Import);
+                    case ConstructKind::Method: return sizeof(Method);
+
+                    // Refined by their statement, expression or type kind.
+                    default: return 0;
+                }
+            }
+
+            case MemorySubject::Statement: {
+                switch (static_cast<StatementKind>(kind)) {
+                    case StatementKind::If: return sizeof(IfStmt);
+                    case StatementKind::Return: return sizeof(ReturnStmt);
+                    case StatementKind::VariableDeclaration: return sizeof(VariableDeclStmt);
+                    case StatementKind::Assignment: return sizeof(AssignmentStmt);
+                    case StatementKind::ExprWrapper: return sizeof(ExprWrapperStmt);
+                    case StatementKind::BlockWrapper: return sizeof(BlockWrapperStmt);
+                    default: return sizeof(Statement);
+                }
+            }
+
+            case MemorySubject::Expression: {
+                switch (static_cast<ExpressionKind>(kind)) {
+                    case ExpressionKind::Call: return sizeof(CallExpr);
+                    case ExpressionKind::Operation: return sizeof(OperationExpr);
+                    case ExpressionKind::VariableReference: return sizeof(VariableRefExpr);
+                    case ExpressionKind::BooleanLiteral: return sizeof(BooleanLiteral);
+                    case ExpressionKind::CharLiteral: return sizeof(CharLiteral);
+                    case ExpressionKind::IntegerLiteral: return sizeof(IntegerLiteral);
+                    case ExpressionKind::StringLiteral: return sizeof(StringLiteral);
+                    case ExpressionKind::StructDefinition: return sizeof(StructDefExpr);
+                    case ExpressionKind::Cast: return sizeof(CastExpr);
+                    default: return sizeof(Expression<>);
+                }
+            }
+
+            case MemorySubject::Type: {
+                switch (static_cast<TypeKind>(kind)) {
+                    case TypeKind::Struct: return sizeof(StructType);
+                    case TypeKind::Void: return sizeof(VoidType);
+                    case TypeKind::Integer: return sizeof(IntegerType);
+                    case TypeKind::Boolean: return sizeof(BooleanType);
+                    default: return sizeof(Type);
+                }
+            }
+
+            default: {
+                return 0;
+            }
+        }
+    }
+
+    MemoryCounter MemoryTracker::getCounter(MemorySubject subject, uint32_t kind) noexcept {
+        return kindCounters[static_cast<size_t>(subject)][kind].load();
+    }
+
+    MemoryCounter MemoryTracker::getSubjectCounter(MemorySubject subject) noexcept {
+        return subjectCounters[static_cast<size_t>(subject)].load();
+    }
+
+    void MemoryTracker::beginPhase() noexcept {
+        auto reset = [](AtomicMemoryCounter& counter) {
+            counter.peakCount.store(counter.liveCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            counter.peakBytes.store(counter.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            counter.totalCount.store(0, std::memory_order_relaxed);
+            counter.totalBytes.store(0, std::memory_order_relaxed);
+        };
+
+        for (auto& subjectKindCounters : kindCounters) {
+            for (auto& counter : subjectKindCounters) {
+                reset(counter);
+            }
+        }
+
+        for (auto& counter : subjectCounters) {
+            reset(counter);
+        }
+    }
+#else
+    MemoryCounter MemoryTracker::getCounter(MemorySubject, uint32_t) noexcept {
+        return MemoryCounter{};
+    }
+
+    MemoryCounter MemoryTracker::getSubjectCounter(MemorySubject) noexcept {
+        return MemoryCounter{};
+    }
+
+    void MemoryTracker::beginPhase() noexcept {
+        //
+    }
+#endif
+
+    void MemoryTracker::writeJson(std::ostream& stream, std::string_view phase) {
+        stream << "{\"phase\":";
+        json::writeString(stream, phase);
+        stream << ",\"enabled\":" << (MemoryTracker::isEnabled ? "true" : "false");
+        stream << ",\"subjects\":{";
+
+        for (size_t subjectIndex = 0; subjectIndex < MemoryTracker::subjectCount; subjectIndex++) {
+            MemorySubject subject = static_cast<MemorySubject>(subjectIndex);
+
+            if (subjectIndex > 0) {
+                stream << ",";
+            }
+
+            json::writeString(stream, subjectNames[subjectIndex]);
+            stream << ":{\"total\":";
+            writeJsonCounter(stream, MemoryTracker::getSubjectCounter(subject));
+            stream << ",\"kinds\":{";
+
+            bool isFirstKind = true;
+
+            for (uint32_t kind = 0; kind < MemoryTracker::maxKindCount; kind++) {
+                MemoryCounter counter = MemoryTracker::getCounter(subject, kind);
+
+                // Skip kinds which were not recorded during this phase.
+                if (counter.totalCount == 0 && counter.liveCount == 0) {
+                    continue;
+                }
+
+                if (!isFirstKind) {
+                    stream << ",";
+                }
+
+                json::writeString(stream, findKindName(subject, kind));
+                stream << ":";
+                writeJsonCounter(stream, counter);
+                isFirstKind = false;
+            }
+
+            stream << "}}";
+        }
+
+        stream << "}}";
+    }
+}
@@ -0,0 +1,65 @@
+#include <mutex>
+#include <ionlang/tracking/name_interner.h>
+
+namespace ionlang {
+    std::ostream& operator<<(std::ostream& stream, const InternedName& name) {
+        return stream << *name;
+    }
+
+    NameInterner& NameInterner::getGlobal() {
+        static NameInterner globalInterner{};
+
+        return globalInterner;
+    }
+
+    NameInterner::NameInterner() noexcept :
+        mutex(),
+        strings(),
+        index() {
+        //
+    }
+
+    InternedName NameInterner::intern(std::string_view name) {
+        {
+            std::shared_lock<std::shared_mutex> readLock{this->mutex};
+
+            if (auto existing = this->index.find(name); existing != this->index.end()) {
+                return InternedName(existing->second);
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> writeLock{this->mutex};
+
+        // Another thread may have interned the same name in the meantime.
+        if (auto existing = this->index.find(name); existing != this->index.end()) {
+            return InternedName(existing->second);
+        }
+
+        /**
+         * NOTE: Deque never relocates existing elements on insertion at
+         * the end, so the string view used as the key (and the pointer
+         * given out) remain valid.
+         */
+        const std::string& value = this->strings.emplace_back(name);
+
+        this->index.emplace(std::string_view(value), &value);
+
+        return InternedName(&value);
+    }
+
+    std::optional<InternedName> NameInterner::find(std::string_view name) const {
+        std::shared_lock<std::shared_mutex> readLock{this->mutex};
+
+        if (auto existing = this->index.find(name); existing != this->index.end()) {
+            return InternedName(existing->second);
+        }
+
+        return std::nullopt;
+    }
+
+    size_t NameInterner::getSize() const {
+        std::shared_lock<std::shared_mutex> readLock{this->mutex};
+
+        return this->strings.size();
+    }
+}
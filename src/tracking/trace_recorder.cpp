@@ -0,0 +1,178 @@
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <ionlang/tracking/trace_recorder.h>
+#include <ionlang/tracking/json_writer.h>
+
+namespace ionlang {
+    struct TraceEvent {
+        std::string_view name;
+
+        // Relative to the recorder's epoch.
+        std::chrono::nanoseconds startTime;
+
+        std::chrono::nanoseconds duration;
+
+        std::string detail;
+    };
+
+    struct ThreadBuffer {
+        size_t threadId;
+
+        std::vector<TraceEvent> events;
+    };
+
+    static std::mutex registryMutex{};
+
+    // Buffers outlive their threads, so that spans of finished workers are kept.
+    static std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers{};
+
+    static thread_local ThreadBuffer* threadBuffer = nullptr;
+
+    static std::atomic<std::chrono::steady_clock::rep> epoch{0};
+
+    static ThreadBuffer& findThreadBuffer() {
+        if (threadBuffer == nullptr) {
+            std::lock_guard<std::mutex> lock{registryMutex};
+
+            threadBuffers.push_back(std::make_unique<ThreadBuffer>(ThreadBuffer{
+                threadBuffers.size() + 1,
+                {}
+            }));
+
+            threadBuffer = threadBuffers.back().get();
+        }
+
+        return *threadBuffer;
+    }
+
+    // Trace event timestamps are in microseconds.
+    static double toMicroseconds(std::chrono::nanoseconds duration) noexcept {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+    std::atomic<bool> TraceRecorder::enabled{false};
+
+    void TraceRecorder::setEnabled(bool enabled) noexcept {
+        if (enabled) {
+            epoch.store(
+                std::chrono::steady_clock::now().time_since_epoch().count(),
+                std::memory_order_relaxed
+            );
+        }
+
+        TraceRecorder::enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void TraceRecorder::reset() {
+        std::lock_guard<std::mutex> lock{registryMutex};
+
+        for (const auto& buffer : threadBuffers) {
+            buffer->events.clear();
+        }
+    }
+
+    size_t TraceRecorder::getEventCount() {
+        std::lock_guard<std::mutex> lock{registryMutex};
+        size_t eventCount = 0;
+
+        for (const auto& buffer : threadBuffers) {
+            eventCount += buffer->events.size();
+        }
+
+        return eventCount;
+    }
+
+    void TraceRecorder::recordSpan(
+        std::string_view name,
+        std::chrono::steady_clock::time_point startTime,
+        std::chrono::steady_clock::time_point endTime,
+        std::string detail
+    ) {
+        std::chrono::steady_clock::time_point epochTime{
+            std::chrono::steady_clock::duration{epoch.load(std::memory_order_relaxed)}
+        };
+
+        findThreadBuffer().events.push_back(TraceEvent{
+            name,
+            startTime - epochTime,
+            endTime - startTime,
+            std::move(detail)
+        });
+    }
+
+    void TraceRecorder::writeJson(std::ostream& stream) {
+        std::lock_guard<std::mutex> lock{registryMutex};
+        std::ios_base::fmtflags flags = stream.flags();
+        bool isFirstEvent = true;
+
+        stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" << std::fixed << std::setprecision(3);
+
+        for (const auto& buffer : threadBuffers) {
+            if (buffer->events.empty()) {
+                continue;
+            }
+
+            if (!isFirstEvent) {
+                stream << ",";
+            }
+
+            // Name the thread, so that viewers label its track.
+            stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                << ",\"args\":{\"name\":\"thread " << buffer->threadId << "\"}}";
+
+            isFirstEvent = false;
+
+            for (const auto& event : buffer->events) {
+                stream << ",{\"name\":";
+                json::writeString(stream, event.name);
+
+                stream << ",\"cat\":\"ionlang\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                    << ",\"ts\":" << toMicroseconds(event.startTime)
+                    << ",\"dur\":" << toMicroseconds(event.duration);
+
+                if (!event.detail.empty()) {
+                    stream << ",\"args\":{\"detail\":";
+                    json::writeString(stream, event.detail);
+                    stream << "}";
+                }
+
+                stream << "}";
+            }
+        }
+
+        stream << "]}";
+        stream.flags(flags);
+    }
+
+    TraceSpan::TraceSpan(std::string_view name) noexcept :
+        name(name),
+        detail(),
+        startTime(std::nullopt) {
+        if (TraceRecorder::isEnabled()) {
+            this->startTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    TraceSpan::~TraceSpan() {
+        if (!this->startTime.has_value()) {
+            return;
+        }
+
+        TraceRecorder::recordSpan(
+            this->name,
+            *this->startTime,
+            std::chrono::steady_clock::now(),
+            std::move(this->detail)
+        );
+    }
+
+    bool TraceSpan::isRecording() const noexcept {
+        return this->startTime.has_value();
+    }
+
+    void TraceSpan::setDetail(std::string detail) {
+        this->detail = std::move(detail);
+    }
+}
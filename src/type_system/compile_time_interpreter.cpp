@@ -0,0 +1,509 @@
+#include <ionlang/passes/pass.h>
+#include <ionlang/type_system/compile_time_interpreter.h>
+
+namespace ionlang {
+    /**
+     * Whether the constant is a value of the provided type, without any
+     * conversion.
+     */
+    static bool isOfType(const Constant& constant, const std::shared_ptr<Construct>& construct) {
+        if (construct->constructKind != ConstructKind::Type) {
+            return false;
+        }
+
+        std::shared_ptr<Type> type = construct->staticCast<Type>();
+
+        if (type->qualifiers.has(TypeQualifier::Pointer)) {
+            return false;
+        }
+
+        switch (type->typeKind) {
+            case TypeKind::Boolean: {
+                return std::holds_alternative<bool>(constant);
+            }
+
+            case TypeKind::Integer: {
+                if (!std::holds_alternative<IntegerConstant>(constant)) {
+                    return false;
+                }
+
+                const IntegerConstant& integerConstant = std::get<IntegerConstant>(constant);
+                std::shared_ptr<IntegerType> integerType = type->staticCast<IntegerType>();
+
+                return integerConstant.integerKind == integerType->integerKind
+                    && integerConstant.isSigned == integerType->isSigned;
+            }
+
+            default: {
+                return false;
+            }
+        }
+    }
+
+    static bool isOfSameType(const Constant& constant, const Constant& other) noexcept {
+        if (std::holds_alternative<bool>(constant) || std::holds_alternative<bool>(other)) {
+            return constant.index() == other.index();
+        }
+
+        const IntegerConstant& integerConstant = std::get<IntegerConstant>(constant);
+        const IntegerConstant& otherIntegerConstant = std::get<IntegerConstant>(other);
+
+        return integerConstant.integerKind == otherIntegerConstant.integerKind
+            && integerConstant.isSigned == otherIntegerConstant.isSigned;
+    }
+
+    /**
+     * The name a variable reference refers to. References are looked up
+     * by name, since arguments are not bound to declarations.
+     */
+    static std::optional<std::string> findReferencedName(
+        const PtrResolvable<VariableDeclStmt>& variableDeclRef
+    ) {
+        if (variableDeclRef->id.has_value()) {
+            return ***variableDeclRef->id;
+        }
+        else if (variableDeclRef->isResolved()) {
+            return variableDeclRef->forceGetValue()->name;
+        }
+
+        return std::nullopt;
+    }
+
+    size_t CompileTimeInterpreter::CallKeyHash::operator()(const CallKey& callKey) const noexcept {
+        size_t hash = std::hash<const Function*>{}(callKey.function.get());
+
+        for (const auto& argument : callKey.arguments) {
+            size_t argumentHash = std::holds_alternative<bool>(argument)
+                ? std::hash<bool>{}(std::get<bool>(argument))
+                : std::hash<int64_t>{}(std::get<IntegerConstant>(argument).value);
+
+            hash ^= argumentHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+
+        return hash;
+    }
+
+    CompileTimeInterpreter::ExecutionResult CompileTimeInterpreter::step() noexcept {
+        if (++this->stepCount > this->limits.maxStepCount) {
+            return ExecutionResult::LimitExceeded;
+        }
+
+        return ExecutionResult::Continue;
+    }
+
+    Constant* CompileTimeInterpreter::findLocal(const std::string& name) {
+        for (size_t i = this->scopes.size(); i > this->frameScopeIndex; i--) {
+            auto localIterator = this->scopes[i - 1].find(name);
+
+            if (localIterator != this->scopes[i - 1].end()) {
+                return &localIterator->second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    CompileTimeInterpreter::ExecutionResult CompileTimeInterpreter::declareLocal(
+        const std::string& name,
+        Constant value
+    ) {
+        auto [localIterator, isInserted] = this->scopes.back().insert_or_assign(name, value);
+
+        if (isInserted && ++this->localCount > this->limits.maxLocalCount) {
+            return ExecutionResult::LimitExceeded;
+        }
+
+        return ExecutionResult::Continue;
+    }
+
+    CompileTimeInterpreter::ExecutionResult CompileTimeInterpreter::evaluateExpression(
+        const std::shared_ptr<Expression<>>& expression,
+        std::optional<Constant>& result
+    ) {
+        ExecutionResult executionResult = this->step();
+
+        if (executionResult != ExecutionResult::Continue) {
+            return executionResult;
+        }
+
+        switch (expression->expressionKind) {
+            case ExpressionKind::BooleanLiteral:
+            case ExpressionKind::IntegerLiteral: {
+                result = constant_evaluation::findConstant(expression);
+
+                break;
+            }
+
+            case ExpressionKind::Operation: {
+                std::shared_ptr<OperationExpr> operationExpr =
+                    expression->staticCast<OperationExpr>();
+
+                std::optional<Constant> leftSide = std::nullopt;
+                std::optional<Constant> rightSide = std::nullopt;
+
+                executionResult = this->evaluateExpression(operationExpr->leftSideValue, leftSide);
+
+                if (executionResult != ExecutionResult::Continue) {
+                    return executionResult;
+                }
+
+                if (operationExpr->isBinary()) {
+                    executionResult = this->evaluateExpression(*operationExpr->rightSideValue, rightSide);
+
+                    if (executionResult != ExecutionResult::Continue) {
+                        return executionResult;
+                    }
+                }
+
+                result = constant_evaluation::evaluate(operationExpr->operation, *leftSide, rightSide);
+
+                break;
+            }
+
+            case ExpressionKind::VariableReference: {
+                std::optional<std::string> name = findReferencedName(
+                    expression->staticCast<VariableRefExpr>()->variableDecl
+                );
+
+                // Anything but a local of the current frame is a global.
+                Constant* local = name.has_value() ? this->findLocal(*name) : nullptr;
+
+                if (local != nullptr) {
+                    result = *local;
+                }
+
+                break;
+            }
+
+            case ExpressionKind::Call: {
+                executionResult = this->evaluateCall(expression->staticCast<CallExpr>());
+
+                if (executionResult != ExecutionResult::Continue) {
+                    return executionResult;
+                }
+
+                result = this->returnValue;
+
+                break;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return result.has_value() ? ExecutionResult::Continue : ExecutionResult::Unsupported;
+    }
+
+    CompileTimeInterpreter::ExecutionResult CompileTimeInterpreter::evaluateCall(
+        const std::shared_ptr<CallExpr>& callExpr
+    ) {
+        ionshared::OptPtr<Construct> callee = callExpr->calleeResolvable->getValue();
+
+        if (!ionshared::util::hasValue(callee)) {
+            return ExecutionResult::Unresolved;
+        }
+        // Externs may have side effects, and their bodies are unknown.
+        else if (callee->get()->constructKind != ConstructKind::Function) {
+            return ExecutionResult::Unsupported;
+        }
+
+        std::vector<Constant> arguments{};
+
+        arguments.reserve(callExpr->arguments.size());
+
+        for (const auto& argumentExpr : callExpr->arguments) {
+            std::optional<Constant> argument = std::nullopt;
+            ExecutionResult executionResult = this->evaluateExpression(argumentExpr, argument);
+
+            if (executionResult != ExecutionResult::Continue) {
+                return executionResult;
+            }
+
+            arguments.push_back(*argument);
+        }
+
+        return this->invoke(callee->get()->staticCast<Function>(), arguments);
+    }
+
+    CompileTimeInterpreter::ExecutionResult CompileTimeInterpreter::executeStatement(
+        const std::shared_ptr<Statement>& statement
+    ) {
+        ExecutionResult executionResult = this->step();
+
+        if (executionResult != ExecutionResult::Continue) {
+            return executionResult;
+        }
+
+        std::optional<Constant> value = std::nullopt;
+
+        switch (statement->statementKind) {
+            case StatementKind::VariableDeclaration: {
+                std::shared_ptr<VariableDeclStmt> variableDecl =
+                    statement->staticCast<VariableDeclStmt>();
+
+                executionResult = this->evaluateExpression(variableDecl->value, value);
+
+                if (executionResult != ExecutionResult::Continue) {
+                    return executionResult;
+                }
+
+                ionshared::OptPtr<Type> type = variableDecl->type->getValue();
+
+                if (ionshared::util::hasValue(type) && !isOfType(*value, *type)) {
+                    return ExecutionResult::Unsupported;
+                }
+
+                return this->declareLocal(variableDecl->name, *value);
+            }
+
+            case StatementKind::Assignment: {
+                std::shared_ptr<AssignmentStmt> assignmentStmt =
+                    statement->staticCast<AssignmentStmt>();
+
+                executionResult = this->evaluateExpression(assignmentStmt->value, value);
+
+                if (executionResult != ExecutionResult::Continue) {
+                    return executionResult;
+                }
+
+                std::optional<std::string> name =
+                    findReferencedName(assignmentStmt->variableDeclStmtRef);
+
+                // Looked up once the value was evaluated, since calls may grow the scopes.
+                Constant* local = name.has_value() ? this->findLocal(*name) : nullptr;
+
+                // Assigning to a global would be a side effect.
+                if (local == nullptr) {
+                    return ExecutionResult::Unsupported;
+                }
+
+                // Locals keep their type, which the declaration's value determined.
+                if (!isOfSameType(*value, *local)) {
+                    return ExecutionResult::Unsupported;
+                }
+
+                *local = *value;
+
+                return ExecutionResult::Continue;
+            }
+
+            case StatementKind::Return: {
+                std::shared_ptr<ReturnStmt> returnStmt = statement->staticCast<ReturnStmt>();
+
+                if (ionshared::util::hasValue(returnStmt->value)) {
+                    executionResult = this->evaluateExpression(*returnStmt->value, value);
+
+                    if (executionResult != ExecutionResult::Continue) {
+                        return executionResult;
+                    }
+                }
+
+                this->returnValue = value;
+
+                return ExecutionResult::Return;
+            }
+
+            case StatementKind::If: {
+                std::shared_ptr<IfStmt> ifStmt = statement->staticCast<IfStmt>();
+
+                if (ifStmt->condition->constructKind != ConstructKind::Expression) {
+                    return ExecutionResult::Unsupported;
+                }
+
+                executionResult = this->evaluateExpression(
+                    ifStmt->condition->staticCast<Expression<>>(),
+                    value
+                );
+
+                if (executionResult != ExecutionResult::Continue) {
+                    return executionResult;
+                }
+                else if (!std::holds_alternative<bool>(*value)) {
+                    return ExecutionResult::Unsupported;
+                }
+
+                if (std::get<bool>(*value)) {
+                    return this->executeBlock(ifStmt->consequentBlock);
+                }
+                else if (ionshared::util::hasValue(ifStmt->alternativeBlock)) {
+                    return this->executeBlock(*ifStmt->alternativeBlock);
+                }
+
+                return ExecutionResult::Continue;
+            }
+
+            case StatementKind::BlockWrapper: {
+                return this->executeBlock(
+                    statement->staticCast<BlockWrapperStmt>()->block
+                );
+            }
+
+            case StatementKind::ExprWrapper: {
+                std::shared_ptr<Expression<>> expression =
+                    statement->staticCast<ExprWrapperStmt>()->expression;
+
+                // The result is discarded, so calls need not return a value.
+                if (expression->expressionKind == ExpressionKind::Call) {
+                    return this->evaluateCall(expression->staticCast<CallExpr>());
+                }
+
+                return this->evaluateExpression(expression, value);
+            }
+
+            default: {
+                return ExecutionResult::Unsupported;
+            }
+        }
+    }
+
+    CompileTimeInterpreter::ExecutionResult CompileTimeInterpreter::executeBlock(
+        const std::shared_ptr<Block>& block
+    ) {
+        ExecutionResult executionResult = ExecutionResult::Continue;
+
+        this->scopes.emplace_back();
+
+        for (const auto& statement : block->statements) {
+            executionResult = this->executeStatement(statement);
+
+            if (executionResult != ExecutionResult::Continue) {
+                break;
+            }
+        }
+
+        this->localCount -= this->scopes.back().size();
+        this->scopes.pop_back();
+
+        return executionResult;
+    }
+
+    CompileTimeInterpreter::ExecutionResult CompileTimeInterpreter::invoke(
+        const std::shared_ptr<Function>& function,
+        const std::vector<Constant>& arguments
+    ) {
+        CallKey callKey{function, arguments};
+        auto cacheIterator = this->cache.find(callKey);
+
+        if (cacheIterator != this->cache.end()) {
+            this->returnValue = cacheIterator->second.value;
+
+            return cacheIterator->second.isEvaluable
+                ? ExecutionResult::Continue
+                : ExecutionResult::Unsupported;
+        }
+
+        if (this->callDepth >= this->limits.maxCallDepth) {
+            return ExecutionResult::LimitExceeded;
+        }
+
+        std::shared_ptr<Prototype> prototype = function->prototype;
+        const ScopeTable<Construct>& argumentTypes = prototype->argumentList->symbolTable;
+        ionshared::OptPtr<Type> returnType = prototype->returnType->getValue();
+
+        if (!ionshared::util::hasValue(returnType)) {
+            this->returnValue = std::nullopt;
+
+            return ExecutionResult::Unresolved;
+        }
+        else if (prototype->argumentList->isVariable
+            || argumentTypes.getSize() != arguments.size()) {
+            this->returnValue = std::nullopt;
+            this->cache[callKey] = CallResult{false, std::nullopt};
+
+            return ExecutionResult::Unsupported;
+        }
+
+        size_t callerFrameScopeIndex = this->frameScopeIndex;
+        size_t argumentIndex = 0;
+        ExecutionResult executionResult = ExecutionResult::Continue;
+
+        this->callDepth++;
+        this->frameScopeIndex = this->scopes.size();
+        this->scopes.emplace_back();
+
+        // Arguments are stored in declaration order.
+        for (const auto& [name, argumentType] : argumentTypes) {
+            const Constant& argument = arguments[argumentIndex++];
+
+            executionResult = isOfType(argument, argumentType)
+                ? this->declareLocal(*name, argument)
+                : ExecutionResult::Unsupported;
+
+            if (executionResult != ExecutionResult::Continue) {
+                break;
+            }
+        }
+
+        if (executionResult == ExecutionResult::Continue) {
+            executionResult = this->executeBlock(function->body);
+
+            // Falling off the end of the body returns nothing.
+            if (executionResult == ExecutionResult::Continue) {
+                this->returnValue = std::nullopt;
+                executionResult = ExecutionResult::Return;
+            }
+        }
+
+        this->localCount -= this->scopes.back().size();
+        this->scopes.pop_back();
+        this->frameScopeIndex = callerFrameScopeIndex;
+        this->callDepth--;
+
+        if (executionResult == ExecutionResult::Return) {
+            bool isReturnTypeMatched = this->returnValue.has_value()
+                ? isOfType(*this->returnValue, *returnType)
+                : returnType->get()->typeKind == TypeKind::Void;
+
+            executionResult = isReturnTypeMatched
+                ? ExecutionResult::Continue
+                : ExecutionResult::Unsupported;
+        }
+
+        if (executionResult == ExecutionResult::LimitExceeded
+            || executionResult == ExecutionResult::Unresolved) {
+            this->returnValue = std::nullopt;
+
+            return executionResult;
+        }
+
+        bool isEvaluable = executionResult == ExecutionResult::Continue;
+
+        if (!isEvaluable) {
+            this->returnValue = std::nullopt;
+        }
+
+        this->cache[callKey] = CallResult{isEvaluable, this->returnValue};
+
+        return executionResult;
+    }
+
+    CompileTimeInterpreter::CompileTimeInterpreter(CompileTimeInterpreterLimits limits) noexcept :
+        limits(limits),
+        cache(),
+        scopes(),
+        frameScopeIndex(0),
+        stepCount(0),
+        callDepth(0),
+        localCount(0),
+        returnValue(std::nullopt) {
+        //
+    }
+
+    std::optional<Constant> CompileTimeInterpreter::call(
+        const std::shared_ptr<Function>& function,
+        const std::vector<Constant>& arguments
+    ) {
+        this->stepCount = 0;
+
+        if (this->invoke(function, arguments) != ExecutionResult::Continue) {
+            return std::nullopt;
+        }
+
+        return this->returnValue;
+    }
+
+    size_t CompileTimeInterpreter::getCacheSize() const noexcept {
+        return this->cache.size();
+    }
+}
@@ -0,0 +1,302 @@
+#include <ionlang/construct/struct_definition.h>
+#include <ionlang/type_system/constant_evaluation.h>
+#include <ionlang/type_system/type_factory.h>
+
+namespace ionlang::constant_evaluation {
+    static std::optional<Constant> evaluateBoolean(
+        IntrinsicOperatorKind operation,
+        bool leftSide,
+        std::optional<bool> rightSide
+    ) noexcept {
+        if (!rightSide.has_value()) {
+            if (operation == IntrinsicOperatorKind::Not) {
+                return !leftSide;
+            }
+
+            return std::nullopt;
+        }
+
+        switch (operation) {
+            case IntrinsicOperatorKind::Equal: {
+                return leftSide == *rightSide;
+            }
+
+            case IntrinsicOperatorKind::NotEqual: {
+                return leftSide != *rightSide;
+            }
+
+            case IntrinsicOperatorKind::And: {
+                return leftSide && *rightSide;
+            }
+
+            case IntrinsicOperatorKind::Or: {
+                return leftSide || *rightSide;
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    static std::optional<Constant> evaluateInteger(
+        IntrinsicOperatorKind operation,
+        const IntegerConstant& leftSide,
+        const IntegerConstant& rightSide
+    ) noexcept {
+        IntegerKind integerKind = leftSide.integerKind;
+        bool isSigned = leftSide.isSigned;
+
+        // Arithmetic is done upon the bit patterns, to wrap around without undefined behavior.
+        uint64_t leftBits = static_cast<uint64_t>(leftSide.value);
+        uint64_t rightBits = static_cast<uint64_t>(rightSide.value);
+
+        auto makeInteger = [&](uint64_t bits) -> Constant {
+            return IntegerConstant{
+                normalize(static_cast<int64_t>(bits), integerKind, isSigned),
+                integerKind,
+                isSigned
+            };
+        };
+
+        // Values are normalized, so unsigned values are zero extended and compare as such.
+        auto isLessThan = [&]() -> bool {
+            return isSigned ? leftSide.value < rightSide.value : leftBits < rightBits;
+        };
+
+        switch (operation) {
+            case IntrinsicOperatorKind::Equal: {
+                return leftSide.value == rightSide.value;
+            }
+
+            case IntrinsicOperatorKind::NotEqual: {
+                return leftSide.value != rightSide.value;
+            }
+
+            case IntrinsicOperatorKind::LessThan: {
+                return isLessThan();
+            }
+
+            case IntrinsicOperatorKind::GreaterThan: {
+                return !isLessThan() && leftSide.value != rightSide.value;
+            }
+
+            case IntrinsicOperatorKind::LessThanOrEqualTo: {
+                return isLessThan() || leftSide.value == rightSide.value;
+            }
+
+            case IntrinsicOperatorKind::GreaterThanOrEqualTo: {
+                return !isLessThan();
+            }
+
+            case IntrinsicOperatorKind::Addition: {
+                return makeInteger(leftBits + rightBits);
+            }
+
+            case IntrinsicOperatorKind::Subtraction: {
+                return makeInteger(leftBits - rightBits);
+            }
+
+            case IntrinsicOperatorKind::Multiplication: {
+                return makeInteger(leftBits * rightBits);
+            }
+
+            case IntrinsicOperatorKind::Division:
+            case IntrinsicOperatorKind::Modulo: {
+                if (rightSide.value == 0) {
+                    return std::nullopt;
+                }
+
+                bool isDivision = operation == IntrinsicOperatorKind::Division;
+
+                if (!isSigned) {
+                    return makeInteger(isDivision ? leftBits / rightBits : leftBits % rightBits);
+                }
+
+                int64_t minimumValue = normalize(
+                    static_cast<int64_t>(uint64_t{1} << (static_cast<uint32_t>(integerKind) - 1)),
+                    integerKind,
+                    true
+                );
+
+                // The quotient overflows, which is undefined for both operations once lowered.
+                if (leftSide.value == minimumValue && rightSide.value == -1) {
+                    return std::nullopt;
+                }
+
+                return makeInteger(static_cast<uint64_t>(
+                    isDivision ? leftSide.value / rightSide.value : leftSide.value % rightSide.value
+                ));
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    bool isRepresentable(IntegerKind integerKind) noexcept {
+        return static_cast<uint32_t>(integerKind) <= 64;
+    }
+
+    int64_t normalize(int64_t value, IntegerKind integerKind, bool isSigned) noexcept {
+        uint32_t width = static_cast<uint32_t>(integerKind);
+
+        if (width >= 64) {
+            return value;
+        }
+
+        uint64_t mask = (uint64_t{1} << width) - 1;
+        uint64_t bits = static_cast<uint64_t>(value) & mask;
+
+        // Sign extend, if the sign bit is set.
+        if (isSigned && (bits >> (width - 1)) != 0) {
+            bits |= ~mask;
+        }
+
+        return static_cast<int64_t>(bits);
+    }
+
+    std::optional<Constant> findConstant(const std::shared_ptr<Expression<>>& expression) {
+        switch (expression->expressionKind) {
+            case ExpressionKind::BooleanLiteral: {
+                return expression->staticCast<BooleanLiteral>()->value;
+            }
+
+            case ExpressionKind::IntegerLiteral: {
+                std::shared_ptr<IntegerLiteral> integerLiteral =
+                    expression->staticCast<IntegerLiteral>();
+
+                ionshared::OptPtr<IntegerType> type = integerLiteral->type->getValue();
+
+                if (!ionshared::util::hasValue(type)
+                    || !isRepresentable(type->get()->integerKind)) {
+                    return std::nullopt;
+                }
+
+                return IntegerConstant{
+                    normalize(integerLiteral->value, type->get()->integerKind, type->get()->isSigned),
+                    type->get()->integerKind,
+                    type->get()->isSigned
+                };
+            }
+
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    std::optional<Constant> convert(
+        const Constant& constant,
+        const std::shared_ptr<Type>& type
+    ) noexcept {
+        if (type->qualifiers.has(TypeQualifier::Pointer)) {
+            return std::nullopt;
+        }
+
+        if (std::holds_alternative<bool>(constant)) {
+            return type->typeKind == TypeKind::Boolean
+                ? std::optional<Constant>(constant)
+                : std::nullopt;
+        }
+
+        if (type->typeKind != TypeKind::Integer) {
+            return std::nullopt;
+        }
+
+        const IntegerConstant& integerConstant = std::get<IntegerConstant>(constant);
+        std::shared_ptr<IntegerType> integerType = type->staticCast<IntegerType>();
+
+        if (!isRepresentable(integerType->integerKind)) {
+            return std::nullopt;
+        }
+
+        // Values are normalized, so only an unsigned 64-bit value may be negative here.
+        bool isNegative = integerConstant.isSigned && integerConstant.value < 0;
+        bool isAboveSignedRange = !integerConstant.isSigned && integerConstant.value < 0;
+
+        if ((isNegative && !integerType->isSigned)
+            || (isAboveSignedRange && integerType->isSigned)
+            || normalize(integerConstant.value, integerType->integerKind, integerType->isSigned)
+                != integerConstant.value) {
+            return std::nullopt;
+        }
+
+        return IntegerConstant{
+            integerConstant.value,
+            integerType->integerKind,
+            integerType->isSigned
+        };
+    }
+
+    bool isStaticInitializer(const std::shared_ptr<Expression<>>& expression) {
+        switch (expression->expressionKind) {
+            case ExpressionKind::BooleanLiteral:
+            case ExpressionKind::CharLiteral:
+            case ExpressionKind::IntegerLiteral:
+            case ExpressionKind::StringLiteral: {
+                return true;
+            }
+
+            case ExpressionKind::StructDefinition: {
+                for (const auto& value : expression->staticCast<StructDefExpr>()->values) {
+                    if (!isStaticInitializer(value)) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            default: {
+                return false;
+            }
+        }
+    }
+
+    std::shared_ptr<Expression<>> makeLiteral(const Constant& constant) {
+        if (std::holds_alternative<bool>(constant)) {
+            return std::make_shared<BooleanLiteral>(std::get<bool>(constant))->flattenExpression();
+        }
+
+        const IntegerConstant& integerConstant = std::get<IntegerConstant>(constant);
+
+        return IntegerLiteral::make(
+            type_factory::typeInteger(integerConstant.integerKind, integerConstant.isSigned),
+            integerConstant.value
+        )->flattenExpression();
+    }
+
+    std::optional<Constant> evaluate(
+        IntrinsicOperatorKind operation,
+        const Constant& leftSide,
+        const std::optional<Constant>& rightSide
+    ) noexcept {
+        if (std::holds_alternative<bool>(leftSide)) {
+            if (rightSide.has_value() && !std::holds_alternative<bool>(*rightSide)) {
+                return std::nullopt;
+            }
+
+            return evaluateBoolean(
+                operation,
+                std::get<bool>(leftSide),
+                rightSide.has_value() ? std::optional<bool>(std::get<bool>(*rightSide)) : std::nullopt
+            );
+        }
+
+        if (!rightSide.has_value() || !std::holds_alternative<IntegerConstant>(*rightSide)) {
+            return std::nullopt;
+        }
+
+        const IntegerConstant& leftInteger = std::get<IntegerConstant>(leftSide);
+        const IntegerConstant& rightInteger = std::get<IntegerConstant>(*rightSide);
+
+        if (leftInteger.integerKind != rightInteger.integerKind
+            || leftInteger.isSigned != rightInteger.isSigned) {
+            return std::nullopt;
+        }
+
+        return evaluateInteger(operation, leftInteger, rightInteger);
+    }
+}
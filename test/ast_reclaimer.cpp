@@ -0,0 +1,59 @@
+#include <ionlang/tracking/ast_reclaimer.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+/**
+ * Create a chain of nested if statements, deep enough to overflow
+ * the stack if it were destroyed recursively.
+ */
+static std::shared_ptr<Block> makeDeeplyNestedBlock(size_t depth) {
+    std::shared_ptr<Block> block = Block::make();
+
+    for (size_t i = 0; i < depth; i++) {
+        block = Block::make({
+            IfStmt::make(std::make_shared<BooleanLiteral>(true), block, std::nullopt)
+        });
+    }
+
+    return block;
+}
+
+TEST(AstReclaimerTest, ReleasesDeeplyNestedTree) {
+    Ast roots{};
+
+    roots.push_back(makeDeeplyNestedBlock(200000));
+
+    std::weak_ptr<Construct> weakBlock = roots.front();
+
+    AstReclaimer::release(std::move(roots));
+
+    EXPECT_TRUE(weakBlock.expired());
+}
+
+TEST(AstReclaimerTest, LeavesSharedRootsIntact) {
+    std::shared_ptr<Block> block = makeDeeplyNestedBlock(10);
+    std::shared_ptr<Statement> statement = block->statements.front();
+
+    AstReclaimer::release({block});
+
+    ASSERT_EQ(block->statements.size(), 1);
+    EXPECT_EQ(block->statements.front(), statement);
+}
+
+TEST(AstReclaimerTest, BackgroundModeReleasesAfterDrain) {
+    AstReclaimer astReclaimer{ReclaimMode::Background};
+    std::weak_ptr<Function> weakFunction;
+
+    {
+        std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+        weakFunction = test::bootstrap::moduleFunction(module, test::constant::bar);
+        astReclaimer.reclaim(std::move(module));
+    }
+
+    astReclaimer.drain();
+
+    EXPECT_EQ(astReclaimer.getPendingJobCount(), 0);
+    EXPECT_TRUE(weakFunction.expired());
+}
@@ -0,0 +1,138 @@
+#include <sstream>
+#include <ionlang/lexical/lexer.h>
+#include <ionlang/passes/parallel_pass_manager.h>
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include <ionlang/tracking/compile_profiler.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+/**
+ * Enables the profiler for the duration of a test, starting from an
+ * empty record.
+ */
+struct ProfilingScope {
+    ProfilingScope() {
+        CompileProfiler::reset();
+        CompileProfiler::setEnabled(true);
+    }
+
+    ~ProfilingScope() {
+        CompileProfiler::setEnabled(false);
+        CompileProfiler::reset();
+    }
+};
+
+TEST(CompileProfilerTest, RecordsNothingWhileDisabled) {
+    CompileProfiler::reset();
+
+    {
+        PhaseTimer timer{test::constant::foo};
+    }
+
+    Lexer(test::constant::foo).scan();
+
+    EXPECT_TRUE(CompileProfiler::getPhases().empty());
+}
+
+TEST(CompileProfilerTest, AccumulatesNestedPhases) {
+    ProfilingScope profilingScope{};
+
+    for (size_t i = 0; i < 2; i++) {
+        PhaseTimer outerTimer{test::constant::foo};
+        PhaseTimer innerTimer{test::constant::bar};
+    }
+
+    std::vector<PhaseTiming> phases = CompileProfiler::getPhases();
+
+    ASSERT_EQ(phases.size(), 2);
+    EXPECT_EQ(phases[0].name, test::constant::foo);
+    EXPECT_EQ(phases[0].depth, 0);
+    EXPECT_EQ(phases[0].invocationCount, 2);
+    EXPECT_EQ(phases[1].name, test::constant::bar);
+    EXPECT_EQ(phases[1].depth, 1);
+    EXPECT_EQ(phases[1].invocationCount, 2);
+    EXPECT_GE(phases[0].sample.duration, phases[1].sample.duration);
+    EXPECT_EQ(CompileProfiler::getPhaseDepth(), 0);
+}
+
+TEST(CompileProfilerTest, TimesPassesAndLoweredFunctions) {
+    ProfilingScope profilingScope{};
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    test::bootstrap::moduleFunction(module, test::constant::foo);
+    test::bootstrap::moduleFunction(module, test::constant::bar);
+
+    ParallelPassManager passManager{2};
+
+    passManager.registerFunctionPass([](std::shared_ptr<ionshared::PassContext> context) {
+        return std::make_shared<NameResolutionPass>(std::move(context));
+    }, "name resolution");
+
+    passManager.run(module, std::make_shared<ionshared::PassContext>());
+    test::bootstrap::irLoweringPass()->visitModule(module);
+
+    std::vector<PhaseTiming> phases = CompileProfiler::getPhases();
+
+    ASSERT_EQ(phases.size(), 2);
+    EXPECT_EQ(phases[0].name, "name resolution");
+    EXPECT_EQ(phases[0].unit, "functions");
+    EXPECT_EQ(phases[0].sample.unitCount, 2);
+    EXPECT_EQ(phases[1].name, "IonIR lowering");
+
+    std::vector<FunctionTiming> slowestFunctions = CompileProfiler::getSlowestFunctions(10);
+
+    ASSERT_EQ(slowestFunctions.size(), 2);
+    EXPECT_GE(slowestFunctions[0].duration, slowestFunctions[1].duration);
+    EXPECT_EQ(CompileProfiler::getSlowestFunctions(1).size(), 1);
+}
+
+TEST(CompileProfilerTest, SamplesHardwareCountersWhenAvailable) {
+    ProfilingScope profilingScope{};
+
+    CompileProfiler::setHardwareCountersEnabled(true);
+
+    {
+        PhaseTimer timer{test::constant::foo};
+
+        timer.setUnits("tokens", 10);
+    }
+
+    CompileProfiler::setHardwareCountersEnabled(false);
+
+    std::vector<PhaseTiming> phases = CompileProfiler::getPhases();
+
+    ASSERT_EQ(phases.size(), 1);
+    EXPECT_EQ(phases[0].unit, "tokens");
+    EXPECT_EQ(phases[0].sample.unitCount, 10);
+
+    // Counters may be unavailable (unsupported, virtualized or not permitted).
+    EXPECT_EQ(
+        phases[0].sample.hardwareCounts.isEmpty(),
+        !HardwareCounters::getForCurrentThread().isAvailable()
+    );
+}
+
+TEST(CompileProfilerTest, WritesReports) {
+    ProfilingScope profilingScope{};
+
+    {
+        PhaseTimer timer{test::constant::foo};
+    }
+
+    std::stringstream reportStream{};
+    std::stringstream jsonStream{};
+
+    CompileProfiler::writeReport(reportStream);
+    CompileProfiler::writeJson(jsonStream, 5);
+
+    EXPECT_NE(reportStream.str().find("Compile time report"), std::string::npos);
+    EXPECT_NE(reportStream.str().find(test::constant::foo), std::string::npos);
+
+    EXPECT_EQ(
+        jsonStream.str().rfind("{\"enabled\":true,\"phases\":[{\"name\":\"foo\",\"depth\":0", 0),
+        0
+    );
+
+    EXPECT_NE(jsonStream.str().find("\"slowestFunctions\":[]"), std::string::npos);
+}
@@ -0,0 +1,218 @@
+#include <ionlang/passes/optimization/constant_folding_pass.h>
+#include <ionlang/type_system/compile_time_interpreter.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+static Constant makeInteger32(int64_t value) {
+    return IntegerConstant{value, IntegerKind::Int32, true};
+}
+
+/**
+ * Create a function taking a single i32 argument and returning an i32,
+ * registered on the module.
+ */
+static std::shared_ptr<Function> makeFunction(
+    const std::shared_ptr<Module>& module,
+    const std::string& name,
+    const std::string& argumentName
+) {
+    ScopeTable<Construct> argumentTypes{};
+
+    argumentTypes.set(argumentName, type_factory::typeInteger32());
+
+    std::shared_ptr<Function> function = Function::make(
+        Prototype::make(
+            name,
+            ArgumentList::make(std::move(argumentTypes)),
+            Resolvable<Type>::make(type_factory::typeInteger32())
+        ),
+
+        Block::make()
+    );
+
+    function->setParent(module);
+    module->context->globalScope.set(name, function);
+
+    return function;
+}
+
+static std::shared_ptr<Expression<>> makeCall(
+    const std::shared_ptr<Function>& callee,
+    const std::shared_ptr<Expression<>>& argument,
+    const std::shared_ptr<Block>& block
+) {
+    PtrResolvable<> calleeResolvable = Resolvable<>::make(
+        ResolvableKind::FunctionLike,
+        std::make_shared<Identifier>(callee->prototype->name),
+        block
+    );
+
+    calleeResolvable->resolve(callee);
+
+    return CallExpr::make(
+        calleeResolvable,
+        {argument},
+        Resolvable<Type>::make(type_factory::typeInteger32())
+    )->flattenExpression();
+}
+
+static void appendStatement(
+    const std::shared_ptr<Block>& block,
+    const std::shared_ptr<Statement>& statement
+) {
+    statement->setParent(block);
+    block->appendStatement(statement);
+}
+
+/**
+ * Create a function returning the square of its argument.
+ */
+static std::shared_ptr<Function> makeSquareFunction(const std::shared_ptr<Module>& module) {
+    std::shared_ptr<Function> function = makeFunction(module, test::constant::foo, test::constant::bar);
+    std::shared_ptr<Block> body = function->body;
+
+    appendStatement(body, ReturnStmt::make(test::bootstrap::makeOperation(
+        IntrinsicOperatorKind::Multiplication,
+        test::bootstrap::makeReference(test::constant::bar, body),
+        test::bootstrap::makeReference(test::constant::bar, body)
+    )));
+
+    return function;
+}
+
+TEST(CompileTimeInterpreterTest, EvaluatesPureFunction) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::shared_ptr<Function> function = makeSquareFunction(module);
+    CompileTimeInterpreter interpreter{};
+
+    EXPECT_EQ(interpreter.call(function, {makeInteger32(7)}), makeInteger32(49));
+    EXPECT_EQ(interpreter.call(function, {makeInteger32(7)}), makeInteger32(49));
+    EXPECT_EQ(interpreter.getCacheSize(), 1);
+
+    // Arguments must match the prototype.
+    EXPECT_FALSE(interpreter.call(function, {Constant{true}}).has_value());
+    EXPECT_FALSE(interpreter.call(function, {}).has_value());
+}
+
+TEST(CompileTimeInterpreterTest, EvaluatesRecursiveCalls) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::shared_ptr<Function> function = makeFunction(module, test::constant::foo, test::constant::bar);
+    std::shared_ptr<Block> body = function->body;
+    std::shared_ptr<Block> consequentBlock = Block::make({
+        ReturnStmt::make(test::bootstrap::makeInteger32Literal(1))
+    });
+
+    // if (bar <= 1) { return 1; } return bar * foo(bar - 1);
+    appendStatement(body, IfStmt::make(
+        test::bootstrap::makeOperation(
+            IntrinsicOperatorKind::LessThanOrEqualTo,
+            test::bootstrap::makeReference(test::constant::bar, body),
+            test::bootstrap::makeInteger32Literal(1)
+        ),
+
+        consequentBlock
+    ));
+
+    appendStatement(body, ReturnStmt::make(test::bootstrap::makeOperation(
+        IntrinsicOperatorKind::Multiplication,
+        test::bootstrap::makeReference(test::constant::bar, body),
+
+        makeCall(function, test::bootstrap::makeOperation(
+            IntrinsicOperatorKind::Subtraction,
+            test::bootstrap::makeReference(test::constant::bar, body),
+            test::bootstrap::makeInteger32Literal(1)
+        ), body)
+    )));
+
+    CompileTimeInterpreter interpreter{};
+
+    EXPECT_EQ(interpreter.call(function, {makeInteger32(5)}), makeInteger32(120));
+    EXPECT_EQ(interpreter.getCacheSize(), 5);
+}
+
+TEST(CompileTimeInterpreterTest, StopsAtLimits) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::shared_ptr<Function> function = makeFunction(module, test::constant::foo, test::constant::bar);
+    std::shared_ptr<Block> body = function->body;
+
+    // return foo(bar + 1);
+    appendStatement(body, ReturnStmt::make(makeCall(function, test::bootstrap::makeOperation(
+        IntrinsicOperatorKind::Addition,
+        test::bootstrap::makeReference(test::constant::bar, body),
+        test::bootstrap::makeInteger32Literal(1)
+    ), body)));
+
+    CompileTimeInterpreter interpreter{CompileTimeInterpreterLimits{
+        .maxStepCount = 1000,
+        .maxCallDepth = 16
+    }};
+
+    EXPECT_FALSE(interpreter.call(function, {makeInteger32(0)}).has_value());
+
+    // Calls which exceeded a limit are not memoized.
+    EXPECT_EQ(interpreter.getCacheSize(), 0);
+}
+
+TEST(CompileTimeInterpreterTest, DoesNotMemoizeUnresolvedCalls) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::shared_ptr<Function> squareFunction = makeSquareFunction(module);
+    std::shared_ptr<Function> function = makeFunction(module, test::constant::foobar, test::constant::bar);
+    std::shared_ptr<Block> body = function->body;
+
+    PtrResolvable<> calleeResolvable = Resolvable<>::make(
+        ResolvableKind::FunctionLike,
+        std::make_shared<Identifier>(squareFunction->prototype->name),
+        body
+    );
+
+    // return foo(bar);
+    appendStatement(body, ReturnStmt::make(CallExpr::make(
+        calleeResolvable,
+        {test::bootstrap::makeReference(test::constant::bar, body)},
+        Resolvable<Type>::make(type_factory::typeInteger32())
+    )->flattenExpression()));
+
+    CompileTimeInterpreter interpreter{};
+
+    EXPECT_FALSE(interpreter.call(function, {makeInteger32(3)}).has_value());
+    EXPECT_EQ(interpreter.getCacheSize(), 0);
+
+    // Once the callee is resolved, the same call is evaluable.
+    calleeResolvable->resolve(squareFunction);
+
+    EXPECT_EQ(interpreter.call(function, {makeInteger32(3)}), makeInteger32(9));
+}
+
+TEST(CompileTimeInterpreterTest, ReplacesCallsWhenFolding) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::shared_ptr<Function> squareFunction = makeSquareFunction(module);
+
+    std::shared_ptr<Function> function =
+        test::bootstrap::moduleFunction(module, test::constant::foobar);
+
+    std::shared_ptr<Block> body = function->body;
+
+    std::shared_ptr<VariableDeclStmt> variableDecl = VariableDeclStmt::make(
+        Resolvable<Type>::make(type_factory::typeInteger32()),
+        test::constant::foobar,
+        makeCall(squareFunction, test::bootstrap::makeInteger32Literal(3), body)
+    );
+
+    appendStatement(body, variableDecl);
+
+    ConstantFoldingPass constantFoldingPass{
+        std::make_shared<ionshared::PassContext>(),
+        std::make_shared<CompileTimeInterpreter>()
+    };
+
+    // Evaluating calls walks other functions, so a lone function may not be folded.
+    EXPECT_THROW(constantFoldingPass.visit(function), std::runtime_error);
+
+    constantFoldingPass.visit(module);
+
+    ASSERT_EQ(variableDecl->value->expressionKind, ExpressionKind::IntegerLiteral);
+    EXPECT_EQ(variableDecl->value->staticCast<IntegerLiteral>()->value, 9);
+    EXPECT_EQ(constantFoldingPass.getStatistics().evaluatedCallCount, 1);
+}
@@ -0,0 +1,106 @@
+#include <atomic>
+#include <thread>
+#include <ionlang/passes/pass.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(ConcurrentScopeTableTest, IteratesInDeclarationOrder) {
+    ConcurrentScopeTable<Construct> scopeTable{};
+    std::vector<std::string> names{};
+
+    // Enough names to force every shard's index to grow.
+    for (size_t i = 0; i < 500; i++) {
+        names.push_back("name_" + std::to_string(500 - i));
+        EXPECT_TRUE(scopeTable.set(names.back(), Block::make()));
+    }
+
+    std::vector<ConcurrentScopeTable<Construct>::Entry> entries = scopeTable.getEntries();
+
+    ASSERT_EQ(entries.size(), names.size());
+
+    for (size_t i = 0; i < names.size(); i++) {
+        EXPECT_EQ(*entries[i].name, names[i]);
+        EXPECT_TRUE(scopeTable.contains(names[i]));
+    }
+}
+
+TEST(ConcurrentScopeTableTest, OverwritesAndRemoves) {
+    ConcurrentScopeTable<Construct> scopeTable{};
+    std::shared_ptr<Block> block = Block::make();
+
+    EXPECT_TRUE(scopeTable.set(test::constant::foo, Block::make()));
+    EXPECT_TRUE(scopeTable.set(test::constant::bar, Block::make()));
+    EXPECT_FALSE(scopeTable.set(test::constant::foo, block));
+    EXPECT_TRUE(scopeTable.set(test::constant::foo, block, true));
+    EXPECT_EQ(*scopeTable.lookup(test::constant::foo), block);
+
+    // Overwritten entries keep their place.
+    EXPECT_EQ(*scopeTable.getEntries().front().name, test::constant::foo);
+
+    EXPECT_TRUE(scopeTable.remove(test::constant::foo));
+    EXPECT_FALSE(scopeTable.remove(test::constant::foo));
+    EXPECT_FALSE(scopeTable.contains(test::constant::foo));
+    EXPECT_TRUE(scopeTable.contains(test::constant::bar));
+    EXPECT_EQ(scopeTable.getSize(), 1);
+
+    // Re-inserted entries are placed last.
+    EXPECT_TRUE(scopeTable.set(test::constant::foo, block));
+    EXPECT_EQ(*scopeTable.getEntries().back().name, test::constant::foo);
+}
+
+/**
+ * Readers and writers racing on the same table. Meant to be run with
+ * the IONLANG_SANITIZE_THREAD option, so that data races are reported.
+ */
+TEST(ConcurrentScopeTableTest, ConcurrentReadersAndWriters) {
+    constexpr size_t writerCount = 4;
+    constexpr size_t readerCount = 4;
+    constexpr size_t namesPerWriter = 2000;
+
+    ConcurrentScopeTable<Construct> scopeTable{};
+    std::atomic<size_t> successfulClaimCount = 0;
+    std::atomic<bool> isWriting = true;
+    std::vector<std::thread> threads{};
+
+    for (size_t i = 0; i < writerCount; i++) {
+        threads.emplace_back([&] {
+            // Writers race for the same names, and only one may claim each.
+            for (size_t j = 0; j < namesPerWriter; j++) {
+                if (scopeTable.set("name_" + std::to_string(j), Block::make())) {
+                    successfulClaimCount++;
+                }
+            }
+        });
+    }
+
+    for (size_t i = 0; i < readerCount; i++) {
+        threads.emplace_back([&] {
+            while (isWriting) {
+                for (size_t j = 0; j < namesPerWriter; j += 97) {
+                    ionshared::OptPtr<Construct> lookupResult =
+                        scopeTable.lookup("name_" + std::to_string(j));
+
+                    if (ionshared::util::hasValue(lookupResult)) {
+                        EXPECT_EQ(lookupResult->get()->constructKind, ConstructKind::Block);
+                    }
+                }
+
+                EXPECT_LE(scopeTable.getEntries().size(), namesPerWriter);
+            }
+        });
+    }
+
+    for (size_t i = 0; i < writerCount; i++) {
+        threads[i].join();
+    }
+
+    isWriting = false;
+
+    for (size_t i = writerCount; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    EXPECT_EQ(successfulClaimCount, namesPerWriter);
+    EXPECT_EQ(scopeTable.getSize(), namesPerWriter);
+}
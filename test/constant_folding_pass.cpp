@@ -0,0 +1,227 @@
+#include <ionlang/passes/optimization/constant_folding_pass.h>
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+static Constant makeInteger(int64_t value, IntegerKind integerKind, bool isSigned = true) {
+    return IntegerConstant{value, integerKind, isSigned};
+}
+
+TEST(ConstantEvaluationTest, WrapsAroundAtTypeWidth) {
+    EXPECT_EQ(
+        constant_evaluation::evaluate(
+            IntrinsicOperatorKind::Addition,
+            makeInteger(127, IntegerKind::Int8),
+            makeInteger(1, IntegerKind::Int8)
+        ),
+
+        makeInteger(-128, IntegerKind::Int8)
+    );
+
+    EXPECT_EQ(
+        constant_evaluation::evaluate(
+            IntrinsicOperatorKind::Addition,
+            makeInteger(200, IntegerKind::Int8, false),
+            makeInteger(100, IntegerKind::Int8, false)
+        ),
+
+        makeInteger(44, IntegerKind::Int8, false)
+    );
+
+    EXPECT_EQ(constant_evaluation::normalize(0xFFFF, IntegerKind::Int16, true), -1);
+}
+
+TEST(ConstantEvaluationTest, RespectsSignedness) {
+    // -1 as an unsigned 32-bit integer is its largest value.
+    Constant allBitsSet = makeInteger(0xFFFFFFFF, IntegerKind::Int32, false);
+
+    EXPECT_EQ(
+        constant_evaluation::evaluate(
+            IntrinsicOperatorKind::GreaterThan,
+            allBitsSet,
+            makeInteger(1, IntegerKind::Int32, false)
+        ),
+
+        Constant{true}
+    );
+
+    EXPECT_EQ(
+        constant_evaluation::evaluate(
+            IntrinsicOperatorKind::LessThan,
+            makeInteger(-1, IntegerKind::Int32),
+            makeInteger(1, IntegerKind::Int32)
+        ),
+
+        Constant{true}
+    );
+
+    EXPECT_EQ(
+        constant_evaluation::evaluate(
+            IntrinsicOperatorKind::Division,
+            makeInteger(-7, IntegerKind::Int32),
+            makeInteger(2, IntegerKind::Int32)
+        ),
+
+        makeInteger(-3, IntegerKind::Int32)
+    );
+}
+
+TEST(ConstantEvaluationTest, RejectsUndefinedAndMismatchedOperations) {
+    EXPECT_FALSE(constant_evaluation::evaluate(
+        IntrinsicOperatorKind::Division,
+        makeInteger(1, IntegerKind::Int32),
+        makeInteger(0, IntegerKind::Int32)
+    ).has_value());
+
+    EXPECT_FALSE(constant_evaluation::evaluate(
+        IntrinsicOperatorKind::Modulo,
+        makeInteger(-128, IntegerKind::Int8),
+        makeInteger(-1, IntegerKind::Int8)
+    ).has_value());
+
+    EXPECT_FALSE(constant_evaluation::evaluate(
+        IntrinsicOperatorKind::Addition,
+        makeInteger(1, IntegerKind::Int32),
+        makeInteger(1, IntegerKind::Int64)
+    ).has_value());
+
+    EXPECT_FALSE(constant_evaluation::evaluate(
+        IntrinsicOperatorKind::Addition,
+        Constant{true},
+        Constant{true}
+    ).has_value());
+}
+
+TEST(ConstantFoldingPassTest, FoldsAndPropagatesConstants) {
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction();
+    std::shared_ptr<Block> body = function->body;
+
+    test::bootstrap::appendVariableDecl(body, test::constant::foo, test::bootstrap::makeOperation(
+        IntrinsicOperatorKind::Multiplication,
+        test::bootstrap::makeInteger32Literal(2),
+        test::bootstrap::makeInteger32Literal(3)
+    ));
+
+    std::shared_ptr<VariableDeclStmt> barDecl =
+        test::bootstrap::appendVariableDecl(body, test::constant::bar, test::bootstrap::makeOperation(
+        IntrinsicOperatorKind::Addition,
+        test::bootstrap::makeReference(test::constant::foo, body),
+        test::bootstrap::makeInteger32Literal(1)
+    ));
+
+    NameResolutionPass nameResolutionPass{std::make_shared<ionshared::PassContext>()};
+    ConstantFoldingPass constantFoldingPass{std::make_shared<ionshared::PassContext>()};
+
+    nameResolutionPass.visit(function);
+    constantFoldingPass.visit(function);
+
+    ASSERT_EQ(barDecl->value->expressionKind, ExpressionKind::IntegerLiteral);
+    EXPECT_EQ(barDecl->value->staticCast<IntegerLiteral>()->value, 7);
+    EXPECT_EQ(constantFoldingPass.getStatistics().foldedOperationCount, 2);
+    EXPECT_EQ(constantFoldingPass.getStatistics().propagatedReferenceCount, 1);
+    EXPECT_EQ(constantFoldingPass.getStatistics().removedIonIrNodeCount, 4);
+}
+
+TEST(ConstantFoldingPassTest, DoesNotPropagateAssignedVariables) {
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction();
+    std::shared_ptr<Block> body = function->body;
+
+    test::bootstrap::appendVariableDecl(body, test::constant::foo, test::bootstrap::makeInteger32Literal(1));
+
+    std::shared_ptr<VariableDeclStmt> barDecl =
+        test::bootstrap::appendVariableDecl(body, test::constant::bar, test::bootstrap::makeOperation(
+        IntrinsicOperatorKind::Addition,
+        test::bootstrap::makeReference(test::constant::foo, body),
+        test::bootstrap::makeInteger32Literal(1)
+    ));
+
+    std::shared_ptr<AssignmentStmt> assignmentStmt = AssignmentStmt::make(
+        Resolvable<VariableDeclStmt>::make(
+            ResolvableKind::VariableLike,
+            std::make_shared<Identifier>(test::constant::foo),
+            body
+        ),
+
+        test::bootstrap::makeInteger32Literal(2)
+    );
+
+    assignmentStmt->setParent(body);
+    body->appendStatement(assignmentStmt);
+
+    NameResolutionPass nameResolutionPass{std::make_shared<ionshared::PassContext>()};
+    ConstantFoldingPass constantFoldingPass{std::make_shared<ionshared::PassContext>()};
+
+    nameResolutionPass.visit(function);
+    constantFoldingPass.visit(function);
+
+    EXPECT_EQ(barDecl->value->expressionKind, ExpressionKind::Operation);
+    EXPECT_EQ(constantFoldingPass.getStatistics().propagatedReferenceCount, 0);
+}
+
+TEST(ConstantFoldingPassTest, PropagatesConstantsWithDeclaredType) {
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction();
+    std::shared_ptr<Block> body = function->body;
+
+    // The literal fits in (and thus defaults to) an i32, but the variable is an i64.
+    std::shared_ptr<VariableDeclStmt> fooDecl = VariableDeclStmt::make(
+        Resolvable<Type>::make(type_factory::typeInteger64()),
+        test::constant::foo,
+        test::bootstrap::makeInteger32Literal(2'000'000'000)
+    );
+
+    fooDecl->setParent(body);
+    body->appendStatement(fooDecl);
+
+    std::shared_ptr<VariableDeclStmt> barDecl = VariableDeclStmt::make(
+        Resolvable<Type>::make(type_factory::typeInteger64()),
+        test::constant::bar,
+
+        test::bootstrap::makeOperation(
+            IntrinsicOperatorKind::Addition,
+            test::bootstrap::makeReference(test::constant::foo, body),
+            test::bootstrap::makeReference(test::constant::foo, body)
+        )
+    );
+
+    barDecl->setParent(body);
+    body->appendStatement(barDecl);
+
+    NameResolutionPass nameResolutionPass{std::make_shared<ionshared::PassContext>()};
+    ConstantFoldingPass constantFoldingPass{std::make_shared<ionshared::PassContext>()};
+
+    nameResolutionPass.visit(function);
+    constantFoldingPass.visit(function);
+
+    // Folded with i64 arithmetic, rather than wrapping around as an i32.
+    ASSERT_EQ(barDecl->value->expressionKind, ExpressionKind::IntegerLiteral);
+
+    std::shared_ptr<IntegerLiteral> integerLiteral = barDecl->value->staticCast<IntegerLiteral>();
+
+    EXPECT_EQ(integerLiteral->value, 4'000'000'000);
+    EXPECT_EQ(integerLiteral->type->forceGetValue()->integerKind, IntegerKind::Int64);
+    EXPECT_EQ(constantFoldingPass.getStatistics().propagatedReferenceCount, 2);
+}
+
+TEST(ConstantFoldingPassTest, FoldsGlobalInitializers) {
+    std::shared_ptr<Global> global = Global::make(
+        Resolvable<Type>::make(type_factory::typeInteger32()),
+        test::constant::foo,
+
+        test::bootstrap::makeOperation(
+            IntrinsicOperatorKind::Subtraction,
+            test::bootstrap::makeInteger32Literal(8),
+            test::bootstrap::makeInteger32Literal(2)
+        )
+    );
+
+    EXPECT_FALSE(constant_evaluation::isStaticInitializer(*global->value));
+
+    ConstantFoldingPass constantFoldingPass{std::make_shared<ionshared::PassContext>()};
+
+    constantFoldingPass.visit(global);
+
+    ASSERT_TRUE(constant_evaluation::isStaticInitializer(*global->value));
+    EXPECT_EQ(global->value->get()->staticCast<IntegerLiteral>()->value, 6);
+}
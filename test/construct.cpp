@@ -0,0 +1,160 @@
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include <ionlang/misc/statement_builder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(ConstructTest, EnclosingConstructsPropagateOnAttach) {
+    std::shared_ptr<Block> innerBlock = Block::make();
+
+    // Build bottom-up, attaching the function to the module last.
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction({
+        IfStmt::make(std::make_shared<BooleanLiteral>(true), innerBlock, std::nullopt)
+    });
+
+    EXPECT_EQ(*innerBlock->findParentFunction(), function);
+    EXPECT_EQ(*innerBlock->findEnclosingScope(), function->body);
+    EXPECT_FALSE(ionshared::util::hasValue(innerBlock->findEnclosingModule()));
+
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    module->context->globalScope.set(function->prototype->name, function);
+    function->setParent(module);
+
+    EXPECT_EQ(*innerBlock->findEnclosingModule(), module);
+    EXPECT_EQ(*function->body->findEnclosingModule(), module);
+}
+
+TEST(ConstructTest, RelocateStatementUpdatesParentAndScope) {
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction();
+    std::shared_ptr<Block> body = function->body;
+
+    std::shared_ptr<VariableDeclStmt> variableDecl = VariableDeclStmt::make(
+        Resolvable<Type>::make(type_factory::typeInteger32()),
+        test::constant::foo,
+        IntegerLiteral::make(type_factory::typeInteger32(), 1)->flattenExpression()
+    );
+
+    variableDecl->setParent(body);
+    body->appendStatement(variableDecl);
+    body->createBuilder()->createReturn();
+
+    std::shared_ptr<Block> successorBlock = body->slice(0);
+
+    EXPECT_TRUE(body->statements.empty());
+    EXPECT_FALSE(body->symbolTable.contains(test::constant::foo));
+    ASSERT_EQ(successorBlock->statements.size(), 2);
+    EXPECT_EQ(*successorBlock->symbolTable.lookup(test::constant::foo), variableDecl);
+    EXPECT_EQ(variableDecl->forceGetUnboxedParent(), successorBlock);
+    EXPECT_EQ(*variableDecl->findEnclosingScope(), successorBlock);
+    EXPECT_EQ(*variableDecl->value->findEnclosingScope(), successorBlock);
+    EXPECT_EQ(*variableDecl->findEnclosingFunction(), function);
+}
+
+TEST(ConstructTest, ModuleReleasedWhenLastHandleDropped) {
+    std::shared_ptr<IonIrLoweringPass> irLoweringPass = test::bootstrap::irLoweringPass();
+    std::weak_ptr<Module> weakModule;
+    std::weak_ptr<Function> weakCaller;
+    std::weak_ptr<Resolvable<>> weakCalleeResolvable;
+    std::weak_ptr<Resolvable<Type>> weakReturnType;
+
+    {
+        std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+        std::shared_ptr<Function> callee = test::bootstrap::moduleFunction(
+            module,
+            test::constant::bar,
+            {ReturnStmt::make(std::nullopt)}
+        );
+
+        std::shared_ptr<Function> caller =
+            test::bootstrap::moduleFunction(module, test::constant::foobar);
+
+        PtrResolvable<> calleeResolvable = Resolvable<>::make(
+            ResolvableKind::FunctionLike,
+            std::make_shared<Identifier>(test::constant::bar),
+            caller->body
+        );
+
+        std::shared_ptr<ExprWrapperStmt> callStmt = ExprWrapperStmt::make(CallExpr::make(
+            calleeResolvable,
+            {},
+            Resolvable<Type>::make(type_factory::typeVoid())
+        ));
+
+        std::shared_ptr<ReturnStmt> returnStmt = ReturnStmt::make(std::nullopt);
+
+        callStmt->setParent(caller->body);
+        caller->body->appendStatement(callStmt);
+        returnStmt->setParent(caller->body);
+        caller->body->appendStatement(returnStmt);
+
+        std::shared_ptr<PassManager> passManager = std::make_shared<PassManager>();
+
+        passManager->registerPass(std::make_shared<NameResolutionPass>(
+            std::make_shared<ionshared::PassContext>()
+        ));
+
+        passManager->run(Ast{module});
+
+        ASSERT_TRUE(calleeResolvable->isResolved());
+        EXPECT_EQ(*calleeResolvable->getValue(), callee);
+
+        irLoweringPass->visitModule(module);
+
+        weakModule = module;
+        weakCaller = caller;
+        weakCalleeResolvable = calleeResolvable;
+        weakReturnType = callee->prototype->returnType;
+    }
+
+    // The lowering pass (and its IonIR output) is still alive at this point.
+    EXPECT_TRUE(weakModule.expired());
+    EXPECT_TRUE(weakCaller.expired());
+    EXPECT_TRUE(weakCalleeResolvable.expired());
+    EXPECT_TRUE(weakReturnType.expired());
+}
+
+TEST(ConstructTest, RecursiveReferenceDoesNotRetainFunction) {
+    std::weak_ptr<Function> weakFunction;
+
+    {
+        std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+        std::shared_ptr<Function> function =
+            test::bootstrap::moduleFunction(module, test::constant::bar);
+
+        PtrResolvable<> selfResolvable = Resolvable<>::make(
+            ResolvableKind::FunctionLike,
+            std::make_shared<Identifier>(test::constant::bar),
+            function->body
+        );
+
+        std::shared_ptr<ExprWrapperStmt> callStmt = ExprWrapperStmt::make(CallExpr::make(
+            selfResolvable,
+            {},
+            Resolvable<Type>::make(type_factory::typeVoid())
+        ));
+
+        callStmt->setParent(function->body);
+        function->body->appendStatement(callStmt);
+
+        std::shared_ptr<PassManager> passManager = std::make_shared<PassManager>();
+
+        passManager->registerPass(std::make_shared<NameResolutionPass>(
+            std::make_shared<ionshared::PassContext>()
+        ));
+
+        passManager->run(Ast{module});
+
+        ASSERT_TRUE(selfResolvable->isResolved());
+
+        // The function's parent is only referenced, never re-parented.
+        EXPECT_EQ(function->forceGetParent(), module);
+
+        weakFunction = function;
+    }
+
+    EXPECT_TRUE(weakFunction.expired());
+}
@@ -0,0 +1,148 @@
+#include <ionlang/tracking/construct_table.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(ConstructTableTest, AssignsSequentialIds) {
+    ConstructId constructIdCount = Construct::getConstructIdCount();
+    std::shared_ptr<Block> firstBlock = Block::make();
+    std::shared_ptr<Block> secondBlock = Block::make();
+
+    EXPECT_GE(firstBlock->constructId, constructIdCount);
+    EXPECT_GT(secondBlock->constructId, firstBlock->constructId);
+    EXPECT_GT(Construct::getConstructIdCount(), secondBlock->constructId);
+}
+
+TEST(ConstructTableTest, SetLookupAndRemove) {
+    std::shared_ptr<Block> firstBlock = Block::make();
+    std::shared_ptr<Block> secondBlock = Block::make();
+    std::shared_ptr<Block> thirdBlock = Block::make();
+    ConstructTable<Construct> constructTable{};
+
+    // A construct created before the first entry's is kept outside of the array.
+    constructTable.set(*thirdBlock, firstBlock);
+    constructTable.set(*firstBlock, thirdBlock);
+
+    EXPECT_EQ(constructTable.getSize(), 2);
+    EXPECT_EQ(constructTable.find(*firstBlock), thirdBlock);
+    EXPECT_EQ(constructTable.find(*thirdBlock), firstBlock);
+    EXPECT_FALSE(constructTable.contains(*secondBlock));
+    EXPECT_FALSE(constructTable.lookup(*secondBlock).has_value());
+
+    // Replacing a value does not change the size.
+    constructTable.set(*thirdBlock, secondBlock);
+
+    EXPECT_EQ(constructTable.getSize(), 2);
+    EXPECT_EQ(constructTable.lookup(*thirdBlock), secondBlock);
+
+    EXPECT_TRUE(constructTable.remove(*firstBlock));
+    EXPECT_FALSE(constructTable.remove(*firstBlock));
+    EXPECT_FALSE(constructTable.contains(*firstBlock));
+    EXPECT_EQ(constructTable.getSize(), 1);
+
+    constructTable.clear();
+
+    EXPECT_TRUE(constructTable.isEmpty());
+    EXPECT_FALSE(constructTable.contains(*thirdBlock));
+}
+
+TEST(ConstructTableTest, KeepsDistantIdsApart) {
+    std::shared_ptr<Block> firstBlock = Block::make();
+    std::vector<std::shared_ptr<Block>> blocks{};
+    ConstructTable<Construct> constructTable{};
+
+    constructTable.set(*firstBlock, firstBlock);
+
+    // Constructs created in between are never given a value.
+    for (size_t i = 0; i < 1000; i++) {
+        blocks.push_back(Block::make());
+    }
+
+    std::shared_ptr<Block> lastBlock = Block::make();
+
+    constructTable.set(*lastBlock, lastBlock);
+
+    EXPECT_EQ(constructTable.getSize(), 2);
+    EXPECT_EQ(constructTable.find(*firstBlock), firstBlock);
+    EXPECT_EQ(constructTable.find(*lastBlock), lastBlock);
+    EXPECT_FALSE(constructTable.contains(*blocks.back()));
+
+    constructTable.startJournal();
+    constructTable.set(*blocks.back(), blocks.back());
+    constructTable.rollbackJournal();
+
+    EXPECT_TRUE(constructTable.remove(*lastBlock));
+    EXPECT_FALSE(constructTable.contains(*lastBlock));
+    EXPECT_FALSE(constructTable.contains(*blocks.back()));
+    EXPECT_EQ(constructTable.getSize(), 1);
+}
+
+TEST(ConstructTableTest, RollsBackJournal) {
+    std::shared_ptr<Block> firstBlock = Block::make();
+    std::shared_ptr<Block> secondBlock = Block::make();
+    ConstructTable<Construct> constructTable{};
+
+    constructTable.set(*firstBlock, firstBlock);
+    constructTable.startJournal();
+    constructTable.set(*secondBlock, secondBlock);
+
+    // Replaced values are not journaled.
+    constructTable.set(*firstBlock, secondBlock);
+    constructTable.rollbackJournal();
+
+    EXPECT_EQ(constructTable.getSize(), 1);
+    EXPECT_EQ(constructTable.find(*firstBlock), secondBlock);
+    EXPECT_FALSE(constructTable.contains(*secondBlock));
+}
+
+TEST(ConstructTableTest, ReleasesArrayOnRollback) {
+    std::shared_ptr<Block> declaration = Block::make();
+    ConstructTable<Construct> constructTable{};
+
+    constructTable.set(*declaration, declaration);
+
+    // Each body is created after the previous ones, as when streaming a module.
+    for (size_t i = 0; i < 16; i++) {
+        std::vector<std::shared_ptr<Block>> body{};
+
+        constructTable.startJournal();
+
+        for (size_t j = 0; j < 256; j++) {
+            body.push_back(Block::make());
+            constructTable.set(*body.back(), body.back());
+        }
+
+        // The array only spans the body being lowered, not those before it.
+        EXPECT_LE(constructTable.getDenseCapacity(), 1024);
+
+        constructTable.rollbackJournal();
+
+        EXPECT_EQ(constructTable.getDenseCapacity(), 0);
+        EXPECT_EQ(constructTable.getSize(), 1);
+        EXPECT_FALSE(constructTable.contains(*body.front()));
+    }
+
+    // Kept values are still found, and may be replaced or removed.
+    EXPECT_EQ(constructTable.find(*declaration), declaration);
+    constructTable.set(*declaration, nullptr);
+    EXPECT_TRUE(constructTable.isEmpty());
+}
+
+TEST(ConstructTableTest, RollsBackJournalWhenThrown) {
+    std::shared_ptr<Block> firstBlock = Block::make();
+    std::shared_ptr<Block> secondBlock = Block::make();
+    ConstructTable<Construct> constructTable{};
+
+    constructTable.set(*firstBlock, firstBlock);
+
+    EXPECT_THROW({
+        ConstructTableJournal<Construct> journal{constructTable};
+
+        constructTable.set(*secondBlock, secondBlock);
+
+        throw std::runtime_error("Lowering failed");
+    }, std::runtime_error);
+
+    EXPECT_EQ(constructTable.getSize(), 1);
+    EXPECT_FALSE(constructTable.contains(*secondBlock));
+}
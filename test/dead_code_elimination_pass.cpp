@@ -0,0 +1,116 @@
+#include <ionlang/const/const_name.h>
+#include <ionlang/passes/optimization/dead_code_elimination_pass.h>
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+static std::shared_ptr<VariableDeclStmt> makeVariableDecl(const std::string& name) {
+    return VariableDeclStmt::make(
+        Resolvable<Type>::make(type_factory::typeInteger32()),
+        name,
+        IntegerLiteral::make(type_factory::typeInteger32(), 1)->flattenExpression()
+    );
+}
+
+static std::shared_ptr<IfStmt> makeConstantIf(
+    bool condition,
+    const std::vector<std::shared_ptr<Statement>>& consequentStatements
+) {
+    return IfStmt::make(
+        std::make_shared<BooleanLiteral>(condition),
+        Block::make(consequentStatements)
+    );
+}
+
+TEST(DeadCodeEliminationPassTest, RemovesStatementsAfterTerminal) {
+    std::shared_ptr<ReturnStmt> returnStmt = ReturnStmt::make(std::nullopt);
+
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction({
+        returnStmt,
+        makeVariableDecl(test::constant::foo),
+        ReturnStmt::make(std::nullopt)
+    });
+
+    DeadCodeEliminationPass deadCodeEliminationPass{std::make_shared<ionshared::PassContext>()};
+
+    deadCodeEliminationPass.visit(function);
+
+    ASSERT_EQ(function->body->statements.size(), 1);
+    EXPECT_EQ(function->body->statements.front(), returnStmt);
+    EXPECT_EQ(deadCodeEliminationPass.getStatistics().removedStatementCount, 2);
+}
+
+TEST(DeadCodeEliminationPassTest, EliminatesConstantBranches) {
+    std::shared_ptr<VariableDeclStmt> takenDecl = makeVariableDecl(test::constant::foo);
+    std::shared_ptr<ReturnStmt> returnStmt = ReturnStmt::make(std::nullopt);
+
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction({
+        makeConstantIf(false, {makeVariableDecl(test::constant::bar)}),
+        makeConstantIf(true, {takenDecl, returnStmt}),
+        ReturnStmt::make(std::nullopt)
+    });
+
+    DeadCodeEliminationPass deadCodeEliminationPass{std::make_shared<ionshared::PassContext>()};
+
+    deadCodeEliminationPass.visit(function);
+
+    // The taken branch is inlined, and its return makes the outer one unreachable.
+    ASSERT_EQ(function->body->statements.size(), 2);
+    EXPECT_EQ(function->body->statements[0], takenDecl);
+    EXPECT_EQ(function->body->statements[1], returnStmt);
+    EXPECT_EQ(*takenDecl->getParent(), function->body);
+    EXPECT_TRUE(function->body->symbolTable.contains(test::constant::foo));
+    EXPECT_EQ(deadCodeEliminationPass.getStatistics().removedBranchCount, 2);
+}
+
+TEST(DeadCodeEliminationPassTest, RemovesUnreachableFunctions) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    std::shared_ptr<Function> mainFunction =
+        test::bootstrap::moduleFunction(module, const_name::main);
+
+    test::bootstrap::moduleFunction(module, test::constant::bar, {ReturnStmt::make(std::nullopt)});
+    test::bootstrap::moduleFunction(module, test::constant::foobar);
+
+    std::shared_ptr<ExprWrapperStmt> callStmt = ExprWrapperStmt::make(CallExpr::make(
+        Resolvable<>::make(
+            ResolvableKind::FunctionLike,
+            std::make_shared<Identifier>(test::constant::bar),
+            mainFunction->body
+        ),
+
+        {},
+        Resolvable<Type>::make(type_factory::typeVoid())
+    ));
+
+    callStmt->setParent(mainFunction->body);
+    mainFunction->body->appendStatement(callStmt);
+
+    NameResolutionPass nameResolutionPass{std::make_shared<ionshared::PassContext>()};
+
+    nameResolutionPass.visit(module);
+
+    // Without exported names, every function may be linked against.
+    DeadCodeEliminationPass libraryDeadCodeEliminationPass{std::make_shared<ionshared::PassContext>()};
+
+    libraryDeadCodeEliminationPass.visit(module);
+
+    Context::Scope& globalScope = module->context->globalScope;
+
+    EXPECT_TRUE(globalScope.contains(test::constant::foobar));
+    EXPECT_EQ(libraryDeadCodeEliminationPass.getStatistics().removedFunctionCount, 0);
+
+    DeadCodeEliminationPass deadCodeEliminationPass{
+        std::make_shared<ionshared::PassContext>(),
+        {const_name::main}
+    };
+
+    deadCodeEliminationPass.visit(module);
+
+    EXPECT_TRUE(globalScope.contains(const_name::main));
+    EXPECT_TRUE(globalScope.contains(test::constant::bar));
+    EXPECT_FALSE(globalScope.contains(test::constant::foobar));
+    EXPECT_EQ(deadCodeEliminationPass.getStatistics().removedFunctionCount, 1);
+}
@@ -0,0 +1,53 @@
+#include <ionlang/tracking/hardware_counters.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(HardwareCountersTest, SubtractsOnlyPresentEvents) {
+    HardwareCounts first{};
+    HardwareCounts second{};
+
+    first.counts[static_cast<size_t>(HardwareEvent::Cycles)] = 100;
+    first.counts[static_cast<size_t>(HardwareEvent::Instructions)] = 300;
+    second.counts[static_cast<size_t>(HardwareEvent::Cycles)] = 40;
+
+    HardwareCounts difference = first - second;
+
+    EXPECT_EQ(difference.get(HardwareEvent::Cycles), 60);
+    EXPECT_FALSE(difference.get(HardwareEvent::Instructions).has_value());
+    EXPECT_FALSE(difference.findInstructionsPerCycle().has_value());
+}
+
+TEST(HardwareCountersTest, AccumulatesEvents) {
+    HardwareCounts total{};
+    HardwareCounts counts{};
+
+    EXPECT_TRUE(total.isEmpty());
+
+    counts.counts[static_cast<size_t>(HardwareEvent::Cycles)] = 100;
+    counts.counts[static_cast<size_t>(HardwareEvent::Instructions)] = 250;
+    total += counts;
+    total += counts;
+
+    EXPECT_FALSE(total.isEmpty());
+    EXPECT_EQ(total.get(HardwareEvent::Cycles), 200);
+    EXPECT_DOUBLE_EQ(*total.findInstructionsPerCycle(), 2.5);
+    EXPECT_FALSE(total.get(HardwareEvent::CacheMisses).has_value());
+}
+
+TEST(HardwareCountersTest, ReadsSameEventsEachTime) {
+    HardwareCounters& hardwareCounters = HardwareCounters::getForCurrentThread();
+    HardwareCounts first = hardwareCounters.read();
+    HardwareCounts second = hardwareCounters.read();
+
+    // Unavailable counters read as empty, rather than failing.
+    EXPECT_EQ(first.isEmpty(), !hardwareCounters.isAvailable());
+
+    /**
+     * Counts of a multiplexed group are scaled estimates, which may
+     * decrease between reads, so only the set of events is compared.
+     */
+    for (size_t i = 0; i < HardwareCounts::eventCount; i++) {
+        EXPECT_EQ(first.counts[i].has_value(), second.counts[i].has_value());
+    }
+}
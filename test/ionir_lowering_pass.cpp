@@ -0,0 +1,297 @@
+#include <ionir/construct/function.h>
+#include <ionir/misc/inst_builder.h>
+#include <ionlang/passes/lowering/ionir_lowering_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+/**
+ * Lower the module, and emit the LLVM IR of its IonIR counterpart.
+ */
+static std::string lowerToLlvmIr(
+    const std::shared_ptr<Module>& module,
+    bool useLinearBodies,
+    ionshared::OptPtr<WorkStealingPool> workStealingPool = std::nullopt
+) {
+    IonIrLoweringPass irLoweringPass{
+        std::make_shared<ionshared::PassContext>(),
+        std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>(),
+
+        LoweringOptions{
+            .useLinearBodies = useLinearBodies,
+            .workStealingPool = std::move(workStealingPool)
+        }
+    };
+
+    irLoweringPass.visitModule(module);
+
+    std::optional<std::shared_ptr<ionir::Module>> irModule =
+        irLoweringPass.getModules()->lookup(module->name);
+
+    EXPECT_TRUE(irModule.has_value());
+
+    return test::bootstrap::llvmIr(*irModule);
+}
+
+TEST(IonIrLoweringPassTest, ParallelLoweringMatchesSerial) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::vector<std::string> functionNames{};
+
+    std::shared_ptr<Function> calleeFunction =
+        test::bootstrap::moduleFunction(module, test::constant::bar);
+
+    // The callee is declared before its callers, but calls a function declared after it.
+    for (size_t i = 0; i < 16; i++) {
+        std::string functionName = test::constant::foo + std::to_string(i);
+
+        test::bootstrap::appendCallStmt(test::bootstrap::moduleFunction(module, functionName), calleeFunction);
+        functionNames.push_back(functionName);
+    }
+
+    std::shared_ptr<Function> ifFunction = test::bootstrap::moduleFunction(module, test::constant::foobar, {
+        IfStmt::make(std::make_shared<BooleanLiteral>(true), Block::make())
+    });
+
+    ifFunction->body->statements.front()->setParent(ifFunction->body);
+    test::bootstrap::appendCallStmt(calleeFunction, ifFunction);
+    calleeFunction->body->appendStatement(ReturnStmt::make(std::nullopt));
+    calleeFunction->body->statements.back()->setParent(calleeFunction->body);
+    functionNames.push_back(test::constant::bar);
+    functionNames.push_back(test::constant::foobar);
+
+    std::string serialIr = lowerToLlvmIr(module, false);
+    std::string parallelIr = lowerToLlvmIr(module, false, std::make_shared<WorkStealingPool>(4));
+
+    EXPECT_FALSE(serialIr.empty());
+    EXPECT_EQ(serialIr, parallelIr);
+
+    for (const auto& functionName : functionNames) {
+        EXPECT_NE(serialIr.find("@" + functionName + "("), std::string::npos);
+    }
+}
+
+TEST(IonIrLoweringPassTest, StreamingReleasesBodies) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    std::shared_ptr<Function> calleeFunction = test::bootstrap::moduleFunction(module, test::constant::bar, {
+        ReturnStmt::make(std::nullopt)
+    });
+
+    std::shared_ptr<Function> callerFunction =
+        test::bootstrap::moduleFunction(module, test::constant::foo);
+
+    calleeFunction->body->statements.front()->setParent(calleeFunction->body);
+    test::bootstrap::appendCallStmt(callerFunction, calleeFunction);
+
+    std::vector<std::string> streamedNames{};
+    std::vector<std::shared_ptr<ionir::Function>> irFunctions{};
+
+    IonIrLoweringPass irLoweringPass{
+        std::make_shared<ionshared::PassContext>(),
+        std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>(),
+
+        LoweringOptions{
+            .functionSink = [&](const std::shared_ptr<Function>& function, const std::shared_ptr<ionir::Function>& irFunction) {
+                // The body is complete while the sink runs.
+                EXPECT_FALSE(irFunction->basicBlocks.empty());
+                EXPECT_FALSE(function->body->statements.empty());
+
+                streamedNames.push_back(function->prototype->name);
+                irFunctions.push_back(irFunction);
+            }
+        }
+    };
+
+    irLoweringPass.visitModule(module);
+
+    // Functions are streamed in declaration order, then only their declarations remain.
+    EXPECT_EQ(streamedNames, (std::vector<std::string>{test::constant::bar, test::constant::foo}));
+    EXPECT_TRUE(calleeFunction->body->statements.empty());
+    EXPECT_TRUE(callerFunction->body->statements.empty());
+
+    for (const auto& irFunction : irFunctions) {
+        EXPECT_TRUE(irFunction->basicBlocks.empty());
+    }
+}
+
+static void appendAssignmentStmt(
+    const std::shared_ptr<Block>& block,
+    const std::shared_ptr<VariableDeclStmt>& variableDecl,
+    int64_t value
+) {
+    PtrResolvable<VariableDeclStmt> variableDeclRef = Resolvable<VariableDeclStmt>::make(
+        ResolvableKind::VariableLike,
+        std::make_shared<Identifier>(variableDecl->name),
+        block
+    );
+
+    variableDeclRef->resolve(variableDecl);
+
+    std::shared_ptr<AssignmentStmt> assignmentStmt = AssignmentStmt::make(
+        variableDeclRef,
+        IntegerLiteral::make(type_factory::typeInteger32(), value)->flattenExpression()
+    );
+
+    assignmentStmt->setParent(block);
+    block->appendStatement(assignmentStmt);
+}
+
+/**
+ * Lower the module with immutable locals promoted, and count the stack
+ * slots of the IonIR counterpart of the provided function.
+ */
+static size_t lowerAllocaCount(
+    const std::shared_ptr<Module>& module,
+    const std::string& functionName,
+    bool useLinearBodies
+) {
+    IonIrLoweringPass irLoweringPass{
+        std::make_shared<ionshared::PassContext>(),
+        std::make_shared<ionshared::SymbolTable<std::shared_ptr<ionir::Module>>>(),
+
+        LoweringOptions{
+            .useLinearBodies = useLinearBodies,
+            .promoteImmutableLocals = true
+        }
+    };
+
+    irLoweringPass.visitModule(module);
+
+    std::optional<std::shared_ptr<ionir::Construct>> irFunction = irLoweringPass.getModules()
+        ->lookup(module->name)
+        ->get()
+        ->context
+        ->getGlobalScope()
+        ->lookup(functionName);
+
+    EXPECT_TRUE(irFunction.has_value());
+
+    size_t allocaCount = 0;
+
+    for (const auto& irBasicBlock : irFunction->get()->dynamicCast<ionir::Function>()->basicBlocks) {
+        for (const auto& irInst : irBasicBlock->insts) {
+            if (irInst->dynamicCast<ionir::AllocaInst>() != nullptr) {
+                allocaCount++;
+            }
+        }
+    }
+
+    return allocaCount;
+}
+
+TEST(IonIrLoweringPassTest, PromotesOnlyConstantOrEmittedValues) {
+    for (bool useLinearBodies : {false, true}) {
+        std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+        std::shared_ptr<Function> function = test::bootstrap::moduleFunction(module, test::constant::foo);
+        std::shared_ptr<Block> body = function->body;
+
+        // The only promoted local.
+        test::bootstrap::appendVariableDecl(
+            body,
+            test::constant::foo,
+            test::bootstrap::makeInteger32Literal(1)
+        );
+
+        std::shared_ptr<VariableDeclStmt> mutableVariableDecl = test::bootstrap::appendVariableDecl(
+            body,
+            test::constant::bar,
+            test::bootstrap::makeInteger32Literal(2)
+        );
+
+        appendAssignmentStmt(body, mutableVariableDecl, 3);
+
+        // Binding it to the mutable local's slot would alias the slot.
+        test::bootstrap::appendVariableDecl(
+            body,
+            test::constant::foobar,
+            test::bootstrap::makeReference(mutableVariableDecl, body)
+        );
+
+        // An operation value is only materialized where it is used.
+        test::bootstrap::appendVariableDecl(
+            body,
+            test::constant::foobar + "_operation",
+
+            test::bootstrap::makeOperation(
+                IntrinsicOperatorKind::Addition,
+                test::bootstrap::makeInteger32Literal(4),
+                test::bootstrap::makeInteger32Literal(5)
+            )
+        );
+
+        EXPECT_EQ(lowerAllocaCount(module, test::constant::foo, useLinearBodies), 3);
+    }
+}
+
+TEST(IonIrLoweringPassTest, KeepsStackSlotOfLocalAssignedInNestedBlock) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::shared_ptr<Function> function = test::bootstrap::moduleFunction(module, test::constant::foo);
+    std::shared_ptr<Block> body = function->body;
+    std::shared_ptr<Block> consequentBlock = Block::make();
+
+    std::shared_ptr<VariableDeclStmt> variableDecl = test::bootstrap::appendVariableDecl(
+        body,
+        test::constant::foo,
+        test::bootstrap::makeInteger32Literal(1)
+    );
+
+    std::shared_ptr<IfStmt> ifStmt =
+        IfStmt::make(std::make_shared<BooleanLiteral>(true), consequentBlock);
+
+    ifStmt->setParent(body);
+    body->appendStatement(ifStmt);
+    appendAssignmentStmt(consequentBlock, variableDecl, 2);
+
+    EXPECT_EQ(lowerAllocaCount(module, test::constant::foo, false), 1);
+}
+
+TEST(IonIrLoweringPassTest, LinearBodiesMatchTree) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    std::shared_ptr<Function> calleeFunction =
+        test::bootstrap::moduleFunction(module, test::constant::bar);
+
+    std::shared_ptr<Function> function =
+        test::bootstrap::moduleFunction(module, test::constant::foo);
+
+    std::shared_ptr<Block> body = function->body;
+
+    calleeFunction->body->appendStatement(ReturnStmt::make(std::nullopt));
+    calleeFunction->body->statements.back()->setParent(calleeFunction->body);
+
+    std::shared_ptr<VariableDeclStmt> variableDecl = test::bootstrap::appendVariableDecl(
+        body,
+        test::constant::foo,
+        test::bootstrap::makeInteger32Literal(1)
+    );
+
+    std::shared_ptr<VariableDeclStmt> mutableVariableDecl =
+        test::bootstrap::appendVariableDecl(body, test::constant::bar, OperationExpr::make(
+            Resolvable<Type>::make(type_factory::typeInteger32()),
+            IntrinsicOperatorKind::Addition,
+            test::bootstrap::makeReference(variableDecl, body),
+            test::bootstrap::makeInteger32Literal(2)
+        )->flattenExpression());
+
+    appendAssignmentStmt(body, mutableVariableDecl, 3);
+    test::bootstrap::appendCallStmt(function, calleeFunction);
+
+    test::bootstrap::appendVariableDecl(
+        body,
+        test::constant::foobar,
+        test::bootstrap::makeReference(mutableVariableDecl, body)
+    );
+
+    body->appendStatement(ReturnStmt::make(std::nullopt));
+    body->statements.back()->setParent(body);
+
+    // Otherwise, both runs would fall back to the construct tree.
+    ASSERT_TRUE(LinearBody::fromBlock(body).has_value());
+    ASSERT_TRUE(LinearBody::fromBlock(calleeFunction->body).has_value());
+
+    std::string treeIr = lowerToLlvmIr(module, false);
+
+    EXPECT_FALSE(treeIr.empty());
+    EXPECT_EQ(treeIr, lowerToLlvmIr(module, true));
+}
@@ -0,0 +1,23 @@
+#include <sstream>
+#include <ionlang/tracking/json_writer.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(JsonWriterTest, EscapesStrings) {
+    std::ostringstream stream{};
+
+    json::writeString(stream, std::string_view{"\"a\\b\"\n\t\r\x01\x1f", 10});
+
+    EXPECT_EQ(stream.str(), R"("\"a\\b\"\n\t\r\u0001\u001f")");
+}
+
+TEST(JsonWriterTest, KeepsStreamFormatting) {
+    std::ostringstream stream{};
+
+    json::writeString(stream, "\x02");
+    stream << 10;
+
+    // Integers written afterwards are still decimal.
+    EXPECT_EQ(stream.str(), R"("\u0002")" "10");
+}
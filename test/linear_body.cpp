@@ -0,0 +1,78 @@
+#include <ionlang/passes/lowering/linear_body.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(LinearBodyTest, NodesAreStoredInPostOrder) {
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction();
+    std::shared_ptr<Block> body = function->body;
+
+    std::shared_ptr<VariableDeclStmt> variableDecl = VariableDeclStmt::make(
+        Resolvable<Type>::make(type_factory::typeInteger32()),
+        test::constant::foo,
+        IntegerLiteral::make(type_factory::typeInteger32(), 1)->flattenExpression()
+    );
+
+    variableDecl->setParent(body);
+    body->appendStatement(variableDecl);
+
+    PtrResolvable<VariableDeclStmt> variableDeclRef = Resolvable<VariableDeclStmt>::make(
+        ResolvableKind::VariableLike,
+        std::make_shared<Identifier>(test::constant::foo),
+        body
+    );
+
+    variableDeclRef->resolve(variableDecl);
+
+    std::shared_ptr<ReturnStmt> returnStmt = ReturnStmt::make(OperationExpr::make(
+        Resolvable<Type>::make(type_factory::typeInteger32()),
+        IntrinsicOperatorKind::Addition,
+        std::make_shared<VariableRefExpr>(variableDeclRef),
+        IntegerLiteral::make(type_factory::typeInteger32(), 2)->flattenExpression()
+    )->flattenExpression());
+
+    returnStmt->setParent(body);
+    body->appendStatement(returnStmt);
+
+    std::optional<LinearBody> linearBody = LinearBody::fromBlock(body);
+
+    ASSERT_TRUE(linearBody.has_value());
+
+    std::vector<LinearNodeKind> expectedKinds{
+        LinearNodeKind::IntegerLiteral,
+        LinearNodeKind::VariableDecl,
+        LinearNodeKind::VariableRef,
+        LinearNodeKind::IntegerLiteral,
+        LinearNodeKind::Operation,
+        LinearNodeKind::Return
+    };
+
+    ASSERT_EQ(linearBody->nodes.size(), expectedKinds.size());
+
+    for (size_t i = 0; i < expectedKinds.size(); i++) {
+        EXPECT_EQ(linearBody->nodes[i].kind, expectedKinds[i]);
+    }
+
+    // Operands precede their users.
+    EXPECT_EQ(linearBody->nodes[1].first, 0);
+    EXPECT_EQ(linearBody->nodes[2].first, 1);
+    EXPECT_FALSE(linearBody->nodes[2].hasFlag(LinearNodeFlag::External));
+    EXPECT_EQ(linearBody->nodes[4].first, 2);
+    EXPECT_EQ(linearBody->nodes[4].second, 3);
+    EXPECT_EQ(linearBody->nodes[5].first, 4);
+    EXPECT_TRUE(linearBody->nodes[5].hasFlag(LinearNodeFlag::HasValue));
+
+    EXPECT_EQ(linearBody->integers, (std::vector<int64_t>{1, 2}));
+    EXPECT_EQ(*linearBody->names[linearBody->nodes[1].second], test::constant::foo);
+    ASSERT_EQ(linearBody->variableDecls.size(), 1);
+    EXPECT_EQ(linearBody->variableDecls[0], variableDecl);
+}
+
+TEST(LinearBodyTest, NestedBlocksAreNotLinearized) {
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction({
+        IfStmt::make(std::make_shared<BooleanLiteral>(true), Block::make(), std::nullopt)
+    });
+
+    EXPECT_FALSE(LinearBody::fromBlock(function->body).has_value());
+}
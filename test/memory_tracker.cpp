@@ -0,0 +1,86 @@
+#include <sstream>
+#include <ionlang/tracking/memory_tracker.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(MemoryTrackerTest, TracksLiveConstructsPerKind) {
+    if (!MemoryTracker::isEnabled) {
+        GTEST_SKIP() << "Memory tracking is compiled out";
+    }
+
+    uint32_t ifKind = static_cast<uint32_t>(StatementKind::If);
+    uint32_t statementKind = static_cast<uint32_t>(ConstructKind::Statement);
+
+    MemoryTracker::beginPhase();
+
+    MemoryCounter initialCounter = MemoryTracker::getCounter(MemorySubject::Statement, ifKind);
+    MemoryCounter initialConstructCounter =
+        MemoryTracker::getCounter(MemorySubject::Construct, statementKind);
+
+    {
+        std::shared_ptr<IfStmt> ifStmt =
+            IfStmt::make(std::make_shared<BooleanLiteral>(true), Block::make());
+
+        MemoryCounter counter = MemoryTracker::getCounter(MemorySubject::Statement, ifKind);
+
+        EXPECT_EQ(counter.liveCount, initialCounter.liveCount + 1);
+        EXPECT_EQ(counter.liveBytes, initialCounter.liveBytes + sizeof(IfStmt));
+        EXPECT_EQ(counter.totalCount, 1);
+
+        // Bytes of refined constructs are also accounted on their construct kind.
+        MemoryCounter constructCounter =
+            MemoryTracker::getCounter(MemorySubject::Construct, statementKind);
+
+        EXPECT_EQ(constructCounter.liveCount, initialConstructCounter.liveCount + 1);
+        EXPECT_EQ(constructCounter.liveBytes, initialConstructCounter.liveBytes + sizeof(IfStmt));
+    }
+
+    MemoryCounter counter = MemoryTracker::getCounter(MemorySubject::Statement, ifKind);
+
+    EXPECT_EQ(counter.liveCount, initialCounter.liveCount);
+    EXPECT_EQ(counter.liveBytes, initialCounter.liveBytes);
+    EXPECT_EQ(counter.peakCount, initialCounter.liveCount + 1);
+}
+
+TEST(MemoryTrackerTest, TracksSymbolTableEntries) {
+    if (!MemoryTracker::isEnabled) {
+        GTEST_SKIP() << "Memory tracking is compiled out";
+    }
+
+    size_t initialLiveCount =
+        MemoryTracker::getSubjectCounter(MemorySubject::SymbolTableEntry).liveCount;
+
+    {
+        ScopeTable<Construct> scopeTable{};
+
+        scopeTable.set(test::constant::foo, Block::make());
+        scopeTable.set(test::constant::bar, Block::make());
+
+        ScopeTable<Construct> scopeTableCopy = scopeTable;
+
+        scopeTable.remove(test::constant::foo);
+
+        EXPECT_EQ(
+            MemoryTracker::getSubjectCounter(MemorySubject::SymbolTableEntry).liveCount,
+            initialLiveCount + 3
+        );
+    }
+
+    EXPECT_EQ(
+        MemoryTracker::getSubjectCounter(MemorySubject::SymbolTableEntry).liveCount,
+        initialLiveCount
+    );
+}
+
+TEST(MemoryTrackerTest, WritesJson) {
+    std::stringstream stream{};
+
+    MemoryTracker::writeJson(stream, "test");
+
+    std::string json = stream.str();
+
+    EXPECT_EQ(json.rfind("{\"phase\":\"test\"", 0), 0);
+    EXPECT_NE(json.find("\"construct\":{\"total\":"), std::string::npos);
+    EXPECT_NE(json.find("\"ionIrNode\":{\"total\":"), std::string::npos);
+}
@@ -63,6 +63,86 @@ TEST(NameResolutionPassTest, Run) {
 //    EXPECT_EQ(assignmentStatement->getValue(), functionBody);
 }
 
+static std::shared_ptr<AssignmentStmt> appendAssignment(
+    const std::shared_ptr<Block>& block,
+    const std::string& name
+) {
+    std::shared_ptr<AssignmentStmt> assignmentStmt = AssignmentStmt::make(
+        Resolvable<VariableDeclStmt>::make(
+            ResolvableKind::VariableLike,
+            std::make_shared<Identifier>(name),
+            block
+        ),
+
+        IntegerLiteral::make(type_factory::typeInteger32(), 2)->flattenExpression()
+    );
+
+    assignmentStmt->setParent(block);
+    block->appendStatement(assignmentStmt);
+
+    return assignmentStmt;
+}
+
+static std::shared_ptr<Block> appendNestedBlock(const std::shared_ptr<Block>& block) {
+    std::shared_ptr<Block> nestedBlock = Block::make();
+    std::shared_ptr<BlockWrapperStmt> blockWrapperStmt = BlockWrapperStmt::make(nestedBlock);
+
+    blockWrapperStmt->setParent(block);
+    block->appendStatement(blockWrapperStmt);
+
+    return nestedBlock;
+}
+
+TEST(NameResolutionPassTest, ResolvesInnermostVisibleDeclaration) {
+    NameResolutionPass nameResolutionPass{std::make_shared<ionshared::PassContext>()};
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction();
+    std::shared_ptr<Block> body = function->body;
+
+    std::shared_ptr<VariableDeclStmt> outerDecl = test::bootstrap::appendVariableDecl(
+        body,
+        test::constant::foo,
+        test::bootstrap::makeInteger32Literal(1)
+    );
+
+    std::shared_ptr<Block> nestedBlock = appendNestedBlock(body);
+    std::shared_ptr<AssignmentStmt> outerAssignment = appendAssignment(nestedBlock, test::constant::foo);
+
+    std::shared_ptr<VariableDeclStmt> innerDecl = test::bootstrap::appendVariableDecl(
+        nestedBlock,
+        test::constant::foo,
+        test::bootstrap::makeInteger32Literal(1)
+    );
+
+    std::shared_ptr<AssignmentStmt> innerAssignment = appendAssignment(nestedBlock, test::constant::foo);
+
+    // The inner declaration is no longer visible once its block ends.
+    std::shared_ptr<AssignmentStmt> trailingAssignment = appendAssignment(body, test::constant::foo);
+
+    nameResolutionPass.visit(function);
+
+    EXPECT_EQ(outerAssignment->variableDeclStmtRef->forceGetValue(), outerDecl);
+    EXPECT_EQ(innerAssignment->variableDeclStmtRef->forceGetValue(), innerDecl);
+    EXPECT_EQ(trailingAssignment->variableDeclStmtRef->forceGetValue(), outerDecl);
+    EXPECT_TRUE(nameResolutionPass.getScopeStack().isEmpty());
+}
+
+TEST(NameResolutionPassTest, RejectsReferencesBeforeDeclaration) {
+    NameResolutionPass nameResolutionPass{std::make_shared<ionshared::PassContext>()};
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction();
+
+    appendAssignment(function->body, test::constant::bar);
+    test::bootstrap::appendVariableDecl(
+        function->body,
+        test::constant::bar,
+        test::bootstrap::makeInteger32Literal(1)
+    );
+
+    EXPECT_THROW(nameResolutionPass.visit(function), std::runtime_error);
+
+    // Scopes are unwound regardless.
+    EXPECT_TRUE(nameResolutionPass.getScopeStack().isEmpty());
+}
+
 // TODO: Implement.
 //TEST(NameresolutionPassTest, ResolveCallExprCallee) {
 //    std::shared_ptr<PassManager> passManager = std::make_shared<PassManager>();
@@ -3,7 +3,5 @@ source_filename = "test"
 
 define void @foobar() {
 entry:
-  %foo = alloca i1
-  store i1 true, i1* %foo
   ret void
 }
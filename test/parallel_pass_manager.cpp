@@ -0,0 +1,270 @@
+#include <atomic>
+#include <ionlang/passes/parallel_pass_manager.h>
+#include <ionlang/passes/semantic/macro_expansion_pass.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+/**
+ * Counts the functions it visits, and fails on those whose name
+ * starts with the provided prefix.
+ */
+struct FunctionCheckPass : Pass {
+    std::atomic<size_t>& visitedFunctionCount;
+
+    std::string failurePrefix;
+
+    FunctionCheckPass(
+        std::shared_ptr<ionshared::PassContext> context,
+        std::atomic<size_t>& visitedFunctionCount,
+        std::string failurePrefix
+    ) :
+        Pass(std::move(context)),
+        visitedFunctionCount(visitedFunctionCount),
+        failurePrefix(std::move(failurePrefix)) {
+        //
+    }
+
+    void visitFunction(std::shared_ptr<Function> construct) override {
+        this->visitedFunctionCount++;
+
+        if (!this->failurePrefix.empty()
+            && construct->prototype->name.rfind(this->failurePrefix, 0) == 0) {
+            throw std::runtime_error(construct->prototype->name);
+        }
+    }
+};
+
+TEST(ParallelPassManagerTest, VisitsEachFunctionOncePerPass) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    for (size_t i = 0; i < 100; i++) {
+        test::bootstrap::moduleFunction(module, "function_" + std::to_string(i));
+    }
+
+    std::atomic<size_t> visitedFunctionCount = 0;
+    ParallelPassManager passManager{4};
+
+    for (size_t i = 0; i < 2; i++) {
+        passManager.registerFunctionPass([&](std::shared_ptr<ionshared::PassContext> context) {
+            return std::make_shared<FunctionCheckPass>(std::move(context), visitedFunctionCount, "");
+        });
+    }
+
+    passManager.run(module, std::make_shared<ionshared::PassContext>());
+
+    EXPECT_EQ(visitedFunctionCount, 200);
+}
+
+TEST(ParallelPassManagerTest, ReportsFirstFailingFunctionInDeclarationOrder) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    for (size_t i = 0; i < 100; i++) {
+        /**
+         * With four workers, the second failing function is the first task
+         * of the last worker, while the first one is the last task of the
+         * second worker. The second one thus usually fails first in time.
+         */
+        if (i == 50 || i == 75) {
+            test::bootstrap::moduleFunction(module, "fail_" + std::to_string(i));
+        }
+
+        test::bootstrap::moduleFunction(module, "function_" + std::to_string(i));
+    }
+
+    std::atomic<size_t> visitedFunctionCount = 0;
+    ParallelPassManager passManager{4};
+
+    passManager.registerFunctionPass([&](std::shared_ptr<ionshared::PassContext> context) {
+        return std::make_shared<FunctionCheckPass>(std::move(context), visitedFunctionCount, "fail_");
+    });
+
+    for (size_t i = 0; i < 10; i++) {
+        try {
+            passManager.run(module, std::make_shared<ionshared::PassContext>());
+            FAIL() << "Expected a function pass to fail";
+        }
+        catch (const std::runtime_error& error) {
+            EXPECT_EQ(std::string(error.what()), "fail_50");
+        }
+    }
+}
+
+/**
+ * Logs the constructs it enters, tagged with its name.
+ */
+struct EnterLoggingPass : Pass {
+    std::vector<std::string>& log;
+
+    std::string name;
+
+    EnterLoggingPass(
+        std::shared_ptr<ionshared::PassContext> context,
+        std::vector<std::string>& log,
+        std::string name
+    ) :
+        Pass(std::move(context)),
+        log(log),
+        name(std::move(name)) {
+        //
+    }
+
+    void visitFunction(std::shared_ptr<Function> construct) override {
+        this->log.push_back(this->name + " function");
+    }
+
+    void visitBlock(std::shared_ptr<Block> construct) override {
+        this->log.push_back(this->name + " block");
+    }
+};
+
+TEST(ParallelPassManagerTest, OrdersAndFusesPassesByDependencies) {
+    ParallelPassManager passManager{1};
+
+    auto factory = [](std::shared_ptr<ionshared::PassContext> context) {
+        return std::make_shared<MacroExpansionPass>(std::move(context));
+    };
+
+    passManager.registerFunctionPass(factory, "checker", PassSchedule{
+        true,
+        {},
+        {"name resolution"}
+    });
+
+    passManager.registerFunctionPass(factory, "name resolution", PassSchedule{
+        true,
+        {"macro expansion"}
+    });
+
+    passManager.registerFunctionPass(factory, "macro expansion", PassSchedule{true});
+
+    std::vector<PassRegistration> traversals = passManager.planTraversals();
+
+    ASSERT_EQ(traversals.size(), 2);
+    EXPECT_EQ(*traversals[0].name, "macro expansion + name resolution");
+    EXPECT_EQ(*traversals[1].name, "checker");
+}
+
+TEST(ParallelPassManagerTest, RejectsInvalidDependencies) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::shared_ptr<ionshared::PassContext> context = std::make_shared<ionshared::PassContext>();
+
+    auto factory = [](std::shared_ptr<ionshared::PassContext> context) {
+        return std::make_shared<MacroExpansionPass>(std::move(context));
+    };
+
+    ParallelPassManager unregisteredPassManager{1};
+
+    unregisteredPassManager.registerFunctionPass(factory, test::constant::foo, PassSchedule{
+        true,
+        {test::constant::bar}
+    });
+
+    EXPECT_THROW(unregisteredPassManager.run(module, context), std::runtime_error);
+
+    ParallelPassManager cyclicPassManager{1};
+
+    cyclicPassManager.registerFunctionPass(factory, test::constant::foo, PassSchedule{
+        true,
+        {test::constant::bar}
+    });
+
+    cyclicPassManager.registerFunctionPass(factory, test::constant::bar, PassSchedule{
+        true,
+        {test::constant::foo}
+    });
+
+    EXPECT_THROW(cyclicPassManager.run(module, context), std::runtime_error);
+}
+
+TEST(ParallelPassManagerTest, FusedPassesShareTraversal) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    std::vector<std::string> log{};
+    ParallelPassManager passManager{1};
+
+    test::bootstrap::moduleFunction(module, test::constant::foo);
+
+    for (const auto& name : {test::constant::foo, test::constant::bar}) {
+        passManager.registerFunctionPass([&log, name](std::shared_ptr<ionshared::PassContext> context) {
+            return std::make_shared<EnterLoggingPass>(std::move(context), log, name);
+        }, name, PassSchedule{true});
+    }
+
+    passManager.run(module, std::make_shared<ionshared::PassContext>());
+
+    std::vector<std::string> expectedLog{
+        test::constant::foo + " function",
+        test::constant::bar + " function",
+        test::constant::foo + " block",
+        test::constant::bar + " block"
+    };
+
+    EXPECT_EQ(log, expectedLog);
+}
+
+/**
+ * Counts the functions it visits before the provided amount of functions
+ * was visited by the pass it depends on.
+ */
+struct CompletionCheckPass : Pass {
+    const std::atomic<size_t>& dependencyVisitedFunctionCount;
+
+    size_t functionCount;
+
+    std::atomic<size_t>& earlyVisitedFunctionCount;
+
+    CompletionCheckPass(
+        std::shared_ptr<ionshared::PassContext> context,
+        const std::atomic<size_t>& dependencyVisitedFunctionCount,
+        size_t functionCount,
+        std::atomic<size_t>& earlyVisitedFunctionCount
+    ) :
+        Pass(std::move(context)),
+        dependencyVisitedFunctionCount(dependencyVisitedFunctionCount),
+        functionCount(functionCount),
+        earlyVisitedFunctionCount(earlyVisitedFunctionCount) {
+        //
+    }
+
+    void visitFunction(std::shared_ptr<Function> construct) override {
+        if (this->dependencyVisitedFunctionCount < this->functionCount) {
+            this->earlyVisitedFunctionCount++;
+        }
+    }
+};
+
+TEST(ParallelPassManagerTest, CompletedDependenciesStartNextStage) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+    size_t functionCount = 100;
+
+    for (size_t i = 0; i < functionCount; i++) {
+        test::bootstrap::moduleFunction(module, "function_" + std::to_string(i));
+    }
+
+    std::atomic<size_t> visitedFunctionCount = 0;
+    std::atomic<size_t> earlyVisitedFunctionCount = 0;
+    ParallelPassManager passManager{4};
+
+    passManager.registerFunctionPass([&](std::shared_ptr<ionshared::PassContext> context) {
+        return std::make_shared<FunctionCheckPass>(std::move(context), visitedFunctionCount, "");
+    }, test::constant::foo);
+
+    passManager.registerFunctionPass([&](std::shared_ptr<ionshared::PassContext> context) {
+        return std::make_shared<CompletionCheckPass>(
+            std::move(context),
+            visitedFunctionCount,
+            functionCount,
+            earlyVisitedFunctionCount
+        );
+    }, test::constant::bar, PassSchedule{
+        false,
+        {},
+        {test::constant::foo}
+    });
+
+    passManager.run(module, std::make_shared<ionshared::PassContext>());
+
+    // Without a barrier, the dependent pass would visit functions of a stage still running.
+    EXPECT_EQ(visitedFunctionCount, functionCount);
+    EXPECT_EQ(earlyVisitedFunctionCount, 0);
+}
@@ -102,7 +102,55 @@ TEST(ParserTest, ParseInteger32Type) {
 }
 
 TEST(ParserTest, ParsePointerType) {
-    // TODO: Implement.
+    Parser parser = test::bootstrap::parser({
+        Token(TokenKind::QualifierConst, "const"),
+        Token(TokenKind::TypeInt32, const_name::typeInt32),
+        Token(TokenKind::OperatorMultiplication, "*"),
+        Token(TokenKind::OperatorMultiplication, "*"),
+        Token(TokenKind::SymbolQuestionMark, "?")
+    });
+
+    AstPtrResult<Resolvable<Type>> typeResult = parser.parseType(nullptr);
+
+    EXPECT_TRUE(util::hasValue(typeResult));
+
+    std::shared_ptr<Type> type = **util::getResultValue(typeResult);
+
+    EXPECT_EQ(type->typeKind, TypeKind::Integer);
+    EXPECT_TRUE(type->qualifiers.has(TypeQualifier::Constant));
+    EXPECT_TRUE(type->qualifiers.has(TypeQualifier::Pointer));
+    EXPECT_TRUE(type->qualifiers.has(TypeQualifier::Nullable));
+    EXPECT_FALSE(type->qualifiers.has(TypeQualifier::Reference));
+    EXPECT_EQ(type->qualifiers.getPointerDepth(), 2);
+}
+
+TEST(ParserTest, ParseUserDefinedType) {
+    Parser parser = test::bootstrap::parser({
+        Token(TokenKind::Identifier, test::constant::foo)
+    });
+
+    AstPtrResult<Resolvable<Type>> typeResult = parser.parseType(nullptr);
+
+    EXPECT_TRUE(util::hasValue(typeResult));
+
+    PtrResolvable<Type> type = util::getResultValue(typeResult);
+
+    // The type is only known after name resolution.
+    EXPECT_FALSE(type->isResolved());
+    EXPECT_EQ(***type->id, test::constant::foo);
+}
+
+TEST(ParserTest, RejectQualifiedUserDefinedType) {
+    Parser parser = test::bootstrap::parser({
+        Token(TokenKind::Identifier, test::constant::foo),
+        Token(TokenKind::OperatorMultiplication, "*"),
+        Token(TokenKind::OperatorMultiplication, "*")
+    });
+
+    AstPtrResult<Resolvable<Type>> typeResult = parser.parseType(nullptr);
+
+    // The named type is shared by all of its uses, so it cannot be qualified.
+    EXPECT_FALSE(util::hasValue(typeResult));
 }
 
 // TODO: Update to 'ParseArgS'
@@ -131,7 +179,7 @@ TEST(ParserTest, ParseFunctionBody) {
     AstPtrResult<Block> functionBodyResult = parser.parseBlock(nullptr);
 
     EXPECT_TRUE(util::hasValue(functionBodyResult));
-    EXPECT_TRUE(util::getResultValue(functionBodyResult)->symbolTable->isEmpty());
+    EXPECT_TRUE(util::getResultValue(functionBodyResult)->symbolTable.isEmpty());
 }
 
 TEST(ParserTest, ParseEmptyPrototype) {
@@ -156,7 +204,7 @@ TEST(ParserTest, ParseEmptyPrototype) {
     EXPECT_STREQ(prototype->name.c_str(), test::constant::foobar.c_str());
 
     // Verify prototype's arguments.
-    EXPECT_TRUE(prototype->argumentList->symbolTable->isEmpty());
+    EXPECT_TRUE(prototype->argumentList->symbolTable.isEmpty());
     EXPECT_FALSE(prototype->argumentList->isVariable);
 }
 
@@ -179,7 +227,7 @@ TEST(ParserTest, ParseEmptyFunction) {
     std::shared_ptr<Function> function = util::getResultValue(functionResult);
 
     EXPECT_TRUE(function->verify());
-    EXPECT_TRUE(function->body->symbolTable->isEmpty());
+    EXPECT_TRUE(function->body->symbolTable.isEmpty());
 }
 
 TEST(ParserTest, ParseFunction) {
@@ -227,7 +275,7 @@ TEST(ParserTest, ParseExtern) {
     std::shared_ptr<Prototype> prototype = util::getResultValue(externResult)->prototype;
 
     EXPECT_EQ(prototype->name, test::constant::foobar);
-    EXPECT_TRUE(prototype->argumentList->symbolTable->isEmpty());
+    EXPECT_TRUE(prototype->argumentList->symbolTable.isEmpty());
     EXPECT_FALSE(prototype->argumentList->isVariable);
 }
 
@@ -273,3 +321,28 @@ TEST(ParserTest, ParseBinaryOperationExpr) {
     EXPECT_EQ(leftSideIntegerLiteral->value, expectedValue);
     EXPECT_EQ(rightSideIntegerLiteral->value, expectedValue);
 }
+
+TEST(ParserTest, ParseGlobalWithExpression) {
+    Parser parser = test::bootstrap::parser({
+        Token(TokenKind::KeywordGlobal, "global"),
+        Token(TokenKind::QualifierConst, "const"),
+        Token(TokenKind::TypeInt32, const_name::typeInt32),
+        Token(TokenKind::Identifier, test::constant::foo),
+        Token(TokenKind::SymbolEqual, "="),
+        Token(TokenKind::LiteralInteger, "2"),
+        Token(TokenKind::OperatorMultiplication, "*"),
+        Token(TokenKind::LiteralInteger, "3"),
+        Token(TokenKind::SymbolSemiColon, ";")
+    });
+
+    AstPtrResult<Global> globalResult = parser.parseGlobal(nullptr);
+
+    ASSERT_TRUE(util::hasValue(globalResult));
+
+    std::shared_ptr<Global> global = util::getResultValue(globalResult);
+
+    EXPECT_EQ(global->name, test::constant::foo);
+    EXPECT_TRUE(global->type->forceGetValue()->qualifiers.has(TypeQualifier::Constant));
+    ASSERT_TRUE(ionshared::util::hasValue(global->value));
+    EXPECT_EQ(global->value->get()->expressionKind, ExpressionKind::Operation);
+}
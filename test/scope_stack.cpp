@@ -0,0 +1,61 @@
+#include <ionlang/passes/pass.h>
+#include <ionlang/tracking/scope_stack.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(ScopeStackTest, BindsDeclarationsToDepthAndSlot) {
+    ScopeStack<Construct> scopeStack{};
+    InternedName foo = NameInterner::getGlobal().intern(test::constant::foo);
+    InternedName bar = NameInterner::getGlobal().intern(test::constant::bar);
+    std::shared_ptr<Block> fooValue = Block::make();
+
+    scopeStack.push();
+    scopeStack.declare(bar, Block::make());
+
+    EXPECT_EQ(scopeStack.declare(foo, fooValue), (ScopeBinding{0, 1}));
+
+    std::optional<ScopeBinding> binding = scopeStack.lookup(foo);
+
+    ASSERT_TRUE(binding.has_value());
+    EXPECT_EQ(*binding, (ScopeBinding{0, 1}));
+    EXPECT_EQ(scopeStack.get(*binding), fooValue);
+}
+
+TEST(ScopeStackTest, RestoresShadowedBindingsOnPop) {
+    ScopeStack<Construct> scopeStack{};
+    InternedName foo = NameInterner::getGlobal().intern(test::constant::foo);
+    std::shared_ptr<Block> outerValue = Block::make();
+    std::shared_ptr<Block> innerValue = Block::make();
+
+    scopeStack.push();
+    scopeStack.declare(foo, outerValue);
+
+    {
+        ScopeStack<Construct>::Guard scopeGuard{scopeStack};
+
+        scopeStack.declare(foo, innerValue);
+
+        EXPECT_EQ(scopeStack.getDepth(), 2);
+        EXPECT_EQ(scopeStack.get(*scopeStack.lookup(foo)), innerValue);
+    }
+
+    EXPECT_EQ(scopeStack.getDepth(), 1);
+    EXPECT_EQ(scopeStack.get(*scopeStack.lookup(foo)), outerValue);
+
+    scopeStack.pop();
+
+    EXPECT_TRUE(scopeStack.isEmpty());
+    EXPECT_FALSE(scopeStack.lookup(foo).has_value());
+}
+
+TEST(ScopeStackTest, ThrowsWithoutScope) {
+    ScopeStack<Construct> scopeStack{};
+
+    EXPECT_THROW(scopeStack.pop(), std::runtime_error);
+
+    EXPECT_THROW(
+        scopeStack.declare(NameInterner::getGlobal().intern(test::constant::foo), Block::make()),
+        std::runtime_error
+    );
+}
@@ -0,0 +1,77 @@
+#include <ionlang/passes/pass.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+TEST(ScopeTableTest, AllocatesOnFirstInsertion) {
+    ScopeTable<Construct> scopeTable{};
+
+    EXPECT_FALSE(scopeTable.isAllocated());
+    EXPECT_TRUE(scopeTable.isEmpty());
+    EXPECT_FALSE(ionshared::util::hasValue(scopeTable.lookup(test::constant::foo)));
+    EXPECT_FALSE(scopeTable.isAllocated());
+
+    EXPECT_TRUE(scopeTable.set(test::constant::foo, Block::make()));
+    EXPECT_TRUE(scopeTable.isAllocated());
+    EXPECT_EQ(scopeTable.getSize(), 1);
+}
+
+TEST(ScopeTableTest, IteratesInDeclarationOrder) {
+    ScopeTable<Construct> scopeTable{};
+    std::vector<std::string> names{};
+
+    // Enough names to force the index to grow several times.
+    for (size_t i = 0; i < 100; i++) {
+        names.push_back("name_" + std::to_string(100 - i));
+        EXPECT_TRUE(scopeTable.set(names.back(), Block::make()));
+    }
+
+    size_t index = 0;
+
+    for (const auto& [name, construct] : scopeTable) {
+        EXPECT_EQ(*name, names[index++]);
+    }
+
+    EXPECT_EQ(index, names.size());
+
+    for (const auto& name : names) {
+        EXPECT_TRUE(scopeTable.contains(name));
+    }
+}
+
+TEST(ScopeTableTest, DoesNotOverwriteByDefault) {
+    ScopeTable<Construct> scopeTable{};
+    std::shared_ptr<Block> first = Block::make();
+    std::shared_ptr<Block> second = Block::make();
+
+    EXPECT_TRUE(scopeTable.set(test::constant::foo, first));
+    EXPECT_FALSE(scopeTable.set(test::constant::foo, second));
+    EXPECT_EQ(*scopeTable.lookup(test::constant::foo), first);
+
+    EXPECT_TRUE(scopeTable.set(test::constant::foo, second, true));
+    EXPECT_EQ(*scopeTable.lookup(test::constant::foo), second);
+    EXPECT_EQ(scopeTable.getSize(), 1);
+}
+
+TEST(ScopeTableTest, RemovePreservesOrder) {
+    ScopeTable<Construct> scopeTable{};
+
+    scopeTable.set(test::constant::foo, Block::make());
+    scopeTable.set(test::constant::bar, Block::make());
+    scopeTable.set(test::constant::foobar, Block::make());
+
+    EXPECT_TRUE(scopeTable.remove(test::constant::bar));
+    EXPECT_FALSE(scopeTable.remove(test::constant::bar));
+    EXPECT_FALSE(scopeTable.contains(test::constant::bar));
+    ASSERT_EQ(scopeTable.getSize(), 2);
+    EXPECT_EQ(*scopeTable.begin()->name, test::constant::foo);
+    EXPECT_EQ(*std::next(scopeTable.begin())->name, test::constant::foobar);
+    EXPECT_TRUE(scopeTable.contains(test::constant::foobar));
+}
+
+TEST(ScopeTableTest, InternedNamesAreUnique) {
+    NameInterner& nameInterner = NameInterner::getGlobal();
+
+    EXPECT_EQ(nameInterner.intern(test::constant::foo), nameInterner.intern(test::constant::foo));
+    EXPECT_NE(nameInterner.intern(test::constant::foo), nameInterner.intern(test::constant::bar));
+}
@@ -0,0 +1,125 @@
+#include <ionlang/passes/static_pass.h>
+#include <ionlang/type_system/type_factory.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+struct ConstructCounts {
+    size_t blocks = 0;
+
+    size_t variableDecls = 0;
+
+    size_t integerLiterals = 0;
+
+    size_t resolvables = 0;
+
+    bool operator==(const ConstructCounts& other) const noexcept = default;
+};
+
+struct CountingPass : Pass {
+    ConstructCounts counts{};
+
+    CountingPass() :
+        Pass(std::make_shared<ionshared::PassContext>()) {
+        //
+    }
+
+    void visitBlock(std::shared_ptr<Block> construct) override {
+        this->counts.blocks++;
+    }
+
+    void visitVariableDeclStmt(std::shared_ptr<VariableDeclStmt> construct) override {
+        this->counts.variableDecls++;
+    }
+
+    void visitIntegerLiteral(std::shared_ptr<IntegerLiteral> construct) override {
+        this->counts.integerLiterals++;
+    }
+
+    void visitResolvable(PtrResolvable<> construct) override {
+        this->counts.resolvables++;
+    }
+};
+
+struct CountingStaticPass : StaticPass<CountingStaticPass> {
+    ConstructCounts counts{};
+
+    void visitBlock(const std::shared_ptr<Block>& construct) {
+        this->counts.blocks++;
+    }
+
+    void visitVariableDeclStmt(const std::shared_ptr<VariableDeclStmt>& construct) {
+        this->counts.variableDecls++;
+    }
+
+    void visitIntegerLiteral(const std::shared_ptr<IntegerLiteral>& construct) {
+        this->counts.integerLiterals++;
+    }
+
+    void visitResolvable(const PtrResolvable<>& construct) {
+        this->counts.resolvables++;
+    }
+};
+
+static std::shared_ptr<Function> makeFunction() {
+    std::shared_ptr<Function> function = test::bootstrap::emptyFunction();
+    std::shared_ptr<Block> nestedBlock = Block::make();
+    std::shared_ptr<BlockWrapperStmt> blockWrapperStmt = BlockWrapperStmt::make(nestedBlock);
+
+    blockWrapperStmt->setParent(function->body);
+    function->body->appendStatement(blockWrapperStmt);
+
+    for (const auto& name : {test::constant::foo, test::constant::bar}) {
+        std::shared_ptr<VariableDeclStmt> variableDecl = VariableDeclStmt::make(
+            Resolvable<Type>::make(type_factory::typeInteger32()),
+            name,
+            IntegerLiteral::make(type_factory::typeInteger32(), 1)->flattenExpression()
+        );
+
+        variableDecl->setParent(nestedBlock);
+        nestedBlock->appendStatement(variableDecl);
+    }
+
+    return function;
+}
+
+TEST(StaticPassTest, VisitsSameConstructsAsPass) {
+    std::shared_ptr<Function> function = makeFunction();
+    CountingPass countingPass{};
+    CountingStaticPass countingStaticPass{};
+
+    countingPass.visit(function);
+    countingStaticPass.visit(function);
+
+    EXPECT_EQ(countingStaticPass.counts.blocks, 2);
+    EXPECT_EQ(countingStaticPass.counts.variableDecls, 2);
+    EXPECT_EQ(countingStaticPass.counts.integerLiterals, 2);
+    EXPECT_GT(countingStaticPass.counts.resolvables, 0);
+    EXPECT_EQ(countingStaticPass.counts, countingPass.counts);
+}
+
+struct PruningStaticPass : StaticPass<PruningStaticPass> {
+    size_t integerLiteralCount = 0;
+
+    void visitChildren(const std::shared_ptr<Construct>& construct) {
+        // Do not descend into variable declarations.
+        if (construct->constructKind == ConstructKind::Statement
+            && construct->staticCast<Statement>()->statementKind == StatementKind::VariableDeclaration) {
+            return;
+        }
+
+        StaticPass<PruningStaticPass>::visitChildren(construct);
+    }
+
+    void visitIntegerLiteral(const std::shared_ptr<IntegerLiteral>& construct) {
+        this->integerLiteralCount++;
+    }
+};
+
+TEST(StaticPassTest, UsesDerivedVisitChildren) {
+    PruningStaticPass pruningStaticPass{};
+
+    pruningStaticPass.visit(makeFunction());
+
+    EXPECT_EQ(pruningStaticPass.integerLiteralCount, 0);
+}
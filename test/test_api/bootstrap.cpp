@@ -1,5 +1,6 @@
 #include <ionir/construct/module.h>
 #include <ionir/construct/identifier.h>
+#include <ionir/passes/lowering/llvm_lowering_pass.h>
 #include <ionlang/const/const.h>
 #include <ionlang/type_system/type_factory.h>
 #include "const.h"
@@ -58,6 +59,28 @@ namespace ionlang::test::bootstrap {
         return irCodegenPass;
     }
 
+    std::string llvmIr(const std::shared_ptr<ionir::Module>& irModule) {
+        std::shared_ptr<ionir::LlvmLoweringPass> llvmLoweringPass =
+            std::make_shared<ionir::LlvmLoweringPass>(
+                std::make_shared<ionshared::PassContext>()
+            );
+
+        llvmLoweringPass->visitModule(irModule);
+
+        std::optional<std::shared_ptr<llvm::Module>> llvmModule{std::nullopt};
+
+        // Only the provided module was lowered.
+        for (const auto& [name, module] : llvmLoweringPass->llvmModules->unwrap()) {
+            llvmModule = module;
+        }
+
+        if (!llvmModule.has_value()) {
+            throw std::runtime_error("Module was not lowered by LlvmLoweringPass");
+        }
+
+        return ionshared::LlvmModule(llvmModule->get()).makeIr();
+    }
+
     std::shared_ptr<Function> emptyFunction(const std::vector<std::shared_ptr<Statement>>& statements) {
         std::shared_ptr<VoidType> returnType = type_factory::typeVoid();
 
@@ -73,4 +96,106 @@ namespace ionlang::test::bootstrap {
         // TODO: Provide module parent for function.
         return Function::make(prototype, body);
     }
+
+    std::shared_ptr<Function> moduleFunction(
+        const std::shared_ptr<Module>& module,
+        const std::string& name,
+        const std::vector<std::shared_ptr<Statement>>& statements
+    ) {
+        std::shared_ptr<Prototype> prototype = Prototype::make(
+            name,
+            ArgumentList::make(),
+            Resolvable<Type>::make(type_factory::typeVoid())
+        );
+
+        std::shared_ptr<Function> function =
+            Function::make(prototype, Block::make(statements));
+
+        function->setParent(module);
+        module->context->globalScope.set(name, function);
+
+        return function;
+    }
+
+    std::shared_ptr<Expression<>> makeInteger32Literal(int64_t value) {
+        return IntegerLiteral::make(type_factory::typeInteger32(), value)->flattenExpression();
+    }
+
+    std::shared_ptr<Expression<>> makeReference(
+        const std::string& name,
+        const std::shared_ptr<Block>& block
+    ) {
+        return std::make_shared<VariableRefExpr>(Resolvable<VariableDeclStmt>::make(
+            ResolvableKind::VariableLike,
+            std::make_shared<Identifier>(name),
+            block
+        ))->flattenExpression();
+    }
+
+    std::shared_ptr<Expression<>> makeReference(
+        const std::shared_ptr<VariableDeclStmt>& variableDecl,
+        const std::shared_ptr<Block>& block
+    ) {
+        PtrResolvable<VariableDeclStmt> variableDeclRef = Resolvable<VariableDeclStmt>::make(
+            ResolvableKind::VariableLike,
+            std::make_shared<Identifier>(variableDecl->name),
+            block
+        );
+
+        variableDeclRef->resolve(variableDecl);
+
+        return std::make_shared<VariableRefExpr>(variableDeclRef)->flattenExpression();
+    }
+
+    std::shared_ptr<Expression<>> makeOperation(
+        IntrinsicOperatorKind operation,
+        const std::shared_ptr<Expression<>>& leftSide,
+        const std::shared_ptr<Expression<>>& rightSide
+    ) {
+        return OperationExpr::make(
+            leftSide->type,
+            operation,
+            leftSide,
+            rightSide
+        )->flattenExpression();
+    }
+
+    std::shared_ptr<VariableDeclStmt> appendVariableDecl(
+        const std::shared_ptr<Block>& block,
+        const std::string& name,
+        const std::shared_ptr<Expression<>>& value
+    ) {
+        std::shared_ptr<VariableDeclStmt> variableDecl = VariableDeclStmt::make(
+            Resolvable<Type>::make(type_factory::typeInteger32()),
+            name,
+            value
+        );
+
+        variableDecl->setParent(block);
+        block->appendStatement(variableDecl);
+
+        return variableDecl;
+    }
+
+    void appendCallStmt(
+        const std::shared_ptr<Function>& caller,
+        const std::shared_ptr<Function>& callee
+    ) {
+        PtrResolvable<> calleeResolvable = Resolvable<>::make(
+            ResolvableKind::FunctionLike,
+            std::make_shared<Identifier>(callee->prototype->name),
+            caller->body
+        );
+
+        calleeResolvable->resolve(callee);
+
+        std::shared_ptr<ExprWrapperStmt> callStmt = ExprWrapperStmt::make(CallExpr::make(
+            calleeResolvable,
+            {},
+            Resolvable<Type>::make(type_factory::typeVoid())
+        ));
+
+        callStmt->setParent(caller->body);
+        caller->body->appendStatement(callStmt);
+    }
 }
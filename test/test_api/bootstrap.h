@@ -20,7 +20,70 @@ namespace ionlang::test::bootstrap {
 
     [[nodiscard]] std::shared_ptr<IonIrLoweringPass> irLoweringPass();
 
+    /**
+     * Lower the provided IonIR module to LLVM, and return
+     * the resulting LLVM IR code.
+     */
+    [[nodiscard]] std::string llvmIr(const std::shared_ptr<ionir::Module>& irModule);
+
     [[nodiscard]] std::shared_ptr<Function> emptyFunction(
         const std::vector<std::shared_ptr<Statement>>& statements = {}
     );
+
+    /**
+     * Create a void function with no arguments, and register it
+     * on the provided module.
+     */
+    std::shared_ptr<Function> moduleFunction(
+        const std::shared_ptr<Module>& module,
+        const std::string& name,
+        const std::vector<std::shared_ptr<Statement>>& statements = {}
+    );
+
+    [[nodiscard]] std::shared_ptr<Expression<>> makeInteger32Literal(int64_t value);
+
+    /**
+     * Create a reference to a variable, to be resolved by name from
+     * within the provided block.
+     */
+    [[nodiscard]] std::shared_ptr<Expression<>> makeReference(
+        const std::string& name,
+        const std::shared_ptr<Block>& block
+    );
+
+    /**
+     * Create a reference to a variable, already resolved to the
+     * provided declaration.
+     */
+    [[nodiscard]] std::shared_ptr<Expression<>> makeReference(
+        const std::shared_ptr<VariableDeclStmt>& variableDecl,
+        const std::shared_ptr<Block>& block
+    );
+
+    /**
+     * Create an operation typed after its left side.
+     */
+    [[nodiscard]] std::shared_ptr<Expression<>> makeOperation(
+        IntrinsicOperatorKind operation,
+        const std::shared_ptr<Expression<>>& leftSide,
+        const std::shared_ptr<Expression<>>& rightSide
+    );
+
+    /**
+     * Declare an i32 variable at the end of the block.
+     */
+    std::shared_ptr<VariableDeclStmt> appendVariableDecl(
+        const std::shared_ptr<Block>& block,
+        const std::string& name,
+        const std::shared_ptr<Expression<>>& value
+    );
+
+    /**
+     * Append a statement to the caller's body, calling the callee
+     * without arguments.
+     */
+    void appendCallStmt(
+        const std::shared_ptr<Function>& caller,
+        const std::shared_ptr<Function>& callee
+    );
 }
@@ -0,0 +1,88 @@
+#include <sstream>
+#include <thread>
+#include <ionlang/passes/parallel_pass_manager.h>
+#include <ionlang/passes/semantic/name_resolution_pass.h>
+#include <ionlang/tracking/trace_recorder.h>
+#include "pch.h"
+
+using namespace ionlang;
+
+/**
+ * Enables the recorder for the duration of a test, starting from an
+ * empty trace.
+ */
+struct TracingScope {
+    TracingScope() {
+        TraceRecorder::reset();
+        TraceRecorder::setEnabled(true);
+    }
+
+    ~TracingScope() {
+        TraceRecorder::setEnabled(false);
+        TraceRecorder::reset();
+    }
+};
+
+TEST(TraceRecorderTest, RecordsNothingWhileDisabled) {
+    TraceRecorder::reset();
+
+    {
+        TraceSpan span{"span"};
+
+        EXPECT_FALSE(span.isRecording());
+    }
+
+    EXPECT_EQ(TraceRecorder::getEventCount(), 0);
+}
+
+TEST(TraceRecorderTest, RecordsSpansOfMultipleThreads) {
+    TracingScope tracingScope{};
+
+    {
+        TraceSpan span{"outer"};
+
+        span.setDetail(test::constant::foo);
+
+        std::thread thread{[] {
+            TraceSpan innerSpan{"inner"};
+        }};
+
+        thread.join();
+    }
+
+    EXPECT_EQ(TraceRecorder::getEventCount(), 2);
+
+    std::stringstream stream{};
+
+    TraceRecorder::writeJson(stream);
+
+    std::string json = stream.str();
+
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0);
+    EXPECT_NE(json.find("\"name\":\"outer\",\"cat\":\"ionlang\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"inner\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"detail\":\"foo\"}"), std::string::npos);
+
+    // Each thread is named once.
+    EXPECT_NE(json.find("\"thread_name\""), json.rfind("\"thread_name\""));
+}
+
+TEST(TraceRecorderTest, RecordsEachFunctionVisit) {
+    std::shared_ptr<Module> module = std::make_shared<Module>(test::constant::foo);
+
+    for (size_t i = 0; i < 10; i++) {
+        test::bootstrap::moduleFunction(module, test::constant::foo + std::to_string(i));
+    }
+
+    ParallelPassManager passManager{4};
+
+    passManager.registerFunctionPass([](std::shared_ptr<ionshared::PassContext> context) {
+        return std::make_shared<NameResolutionPass>(std::move(context));
+    }, "name resolution");
+
+    TracingScope tracingScope{};
+
+    passManager.run(module, std::make_shared<ionshared::PassContext>());
+
+    EXPECT_EQ(TraceRecorder::getEventCount(), 10);
+}